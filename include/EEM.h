@@ -2,11 +2,18 @@
 #include "util.h"
 #include "baseSocket.h"
 #include "EemReq.h"
+#include "EemFramer.h"
+#include "RingQueue.h"
+#include "ReconnectPolicy.h"
 #include <vector>
 extern void EEM_Init(void);
 
 using namespace std;
 
+#define EEM_READ_CHUNKS 8 /* evbuffer chains looked at per pass */
+#define EEM_QUEUE_DEPTH 64 /* Requests a session may have outstanding */
+#define EEM_RECONNECT_MS 5000 /* Reconnect delay without a ReconnectPolicy */
+
 // typedef  util::ErrorStatus (EemReq::*eem_callback)(char *, size_t);
 
 enum class EemState 
@@ -19,24 +26,38 @@ enum class EemState
 class Eem
 {   
     public:
-        Eem(string _server, int _port);
+        Eem(string _server, int _port, string _cc_id = "01",
+            struct event_base *_base = baseEvent::get_baseEvent(),
+            ReconnectPolicy *_reconnect = nullptr);
+        Eem(const Eem &) = delete;
+        Eem &operator=(const Eem &) = delete;
         ~Eem();
-        vector<EemReq> request_queue;
+        RingQueue<EemReq, EEM_QUEUE_DEPTH> request_queue;
         SocketBase *EemSocket;
         util::ErrorStatus connect();
+        void scheduleConnect(uint32_t delayMs);
+        void reconnectLater();
         // util::ErrorStatus connect_timeout();
         util::ErrorStatus write(const void *data, size_t size);
         util::ErrorStatus sendNextReq();
+        util::ErrorStatus queueRequest(EemReq &&req);
         static void readCb(struct bufferevent *bev, void *arg);
         static void eventCb(struct bufferevent *bev, short events, void *arg);
         static void connect_timeout(int fd , short what , void *arg);
+        util::ErrorStatus handleEvent(FramerEvent event);
 
         void close();
+        void stop();
         EemState eemStatus;
+        string cc_id;
+        struct event_base *evBase;
         struct event *connect_timeout_ev;
+        ReconnectPolicy *reconnectPolicy;
+        unsigned reconnectAttempts;
 
     private:
         EemReq eemReq;
+        EemFramer framer;
 };
 
 
@@ -1,22 +1,27 @@
 #pragma once
 #include "util.h"
+#include "eem_scan.h"
 #include <iomanip>
 #include <cstring>
 #include <cmath>
 #include <vector>
+#include <string_view>
 
 
+/*
+ * Response parsers; payloads are only read, through an EemTokenizer. The
+ * separator index of the framer, when given, spares them a scan.
+ */
 class EemParser
 {
     public:
         EemParser();
         ~EemParser();
-        util::ErrorStatus parse_RN(char *, size_t);
-        util::ErrorStatus parse_RB(char *, size_t);
-        util::ErrorStatus parse_RI(char *, size_t);
-        util::ErrorStatus parseResponse(char *, size_t);
-        int parse_INT(char *buff, size_t len);
-        const char *eem_getfloat(const char *, uint8_t, float **);
+        util::ErrorStatus parse_RN(const char *, size_t, const eem_fields * = nullptr);
+        util::ErrorStatus parse_RB(const char *, size_t, const eem_fields * = nullptr);
+        util::ErrorStatus parse_RI(const char *, size_t, const eem_fields * = nullptr);
+        util::ErrorStatus parseResponse(const char *, size_t, const eem_fields * = nullptr);
+        int parse_INT(const char *buff, size_t len);
+        size_t eem_getfloat(std::string_view, size_t, float *);
         float eem_atof(char *);
-        const char *eem_getstr(const char *, char *, size_t);
-};
\ No newline at end of file
+};
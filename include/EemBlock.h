@@ -0,0 +1,193 @@
+#pragma once
+#include "EemSchema.h"
+#include "EemTokenizer.h"
+#include "eem_hex.h"
+#include "util.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/* N digital values packed 64 to a word, bit i is the i-th DI or DO */
+template <size_t N>
+class EemBits
+{
+    public:
+        static constexpr size_t Words = (N + 63) / 64;
+
+        constexpr bool test(size_t i) const
+        {
+            return w[i >> 6] >> (i & 63) & 1;
+        }
+        constexpr void set(size_t i, bool v)
+        {
+            uint64_t m = uint64_t(1) << (i & 63);
+
+            w[i >> 6] = v ? w[i >> 6] | m : w[i >> 6] & ~m;
+        }
+        size_t count() const
+        {
+            size_t n = 0;
+
+            for (size_t i = 0; i < Words; i++)
+            {
+                n += __builtin_popcountll(w[i]);
+            }
+            return n;
+        }
+        static constexpr size_t size()
+        {
+            return N;
+        }
+
+        /*
+         * Decode a digital field, one hex digit per 4 values, the most
+         * significant bit first. Values the field does not cover keep
+         * their previous state, as eem_getbit() does.
+         */
+        void decode(std::string_view field)
+        {
+            size_t i = 0;
+
+            for (char c : field)
+            {
+                uint64_t mask;
+
+                if (i >= N)
+                {
+                    break;
+                }
+                mask = N - i < 4 ? (uint64_t(1) << (N - i)) - 1 : 0xF;
+                w[i >> 6] = (w[i >> 6] & ~(mask << (i & 63)))
+                    | uint64_t(flags(c) & mask) << (i & 63);
+                i += 4;
+            }
+        }
+
+    private:
+        /* Hex digit to its 4 values in bit order, anything else to none */
+        static uint8_t flags(char c)
+        {
+            int v = eem_hex_nibble(static_cast<unsigned char>(c));
+
+            if (v < 0)
+            {
+                return 0;
+            }
+            return (v >> 3 & 1) | (v >> 1 & 2) | (v << 1 & 4) | (v << 3 & 8);
+        }
+
+        std::array<uint64_t, Words ? Words : 1> w{};
+};
+
+/*
+ * An EEM block with storage sized to its schema, so a System block holds
+ * exactly 14 analog inputs rather than a table of EEM_MAX_VALUES. decode()
+ * writes an RB response straight into the arrays; with the counts known at
+ * compile time each block type gets its own decode loop. Values are
+ * reached by index or, checked at compile time, by name:
+ *     constexpr size_t Load = EemSystemBlock::schema.ai("System Load");
+ *     float load = system.analogIn<Load>();
+ */
+template <EemBlockId Id>
+class EemBlock
+{
+    public:
+        static constexpr const EemBlockSchema &schema = eemSchema(Id);
+        static constexpr size_t AiCount = schema.aiCount;
+        static constexpr size_t AoCount = schema.aoCount;
+        static constexpr size_t DiCount = schema.diCount;
+        static constexpr size_t DoCount = schema.doCount;
+
+        std::array<float, AiCount> ai{};
+        std::array<float, AoCount> ao{};
+        EemBits<DiCount> di;
+        EemBits<DoCount> dout;
+
+        template <size_t I>
+        float analogIn() const
+        {
+            static_assert(I < AiCount, "no such analog input");
+            return ai[I];
+        }
+        template <size_t I>
+        float analogOut() const
+        {
+            static_assert(I < AoCount, "no such analog output");
+            return ao[I];
+        }
+        template <size_t I>
+        bool digitalIn() const
+        {
+            static_assert(I < DiCount, "no such digital input");
+            return di.test(I);
+        }
+        template <size_t I>
+        bool digitalOut() const
+        {
+            static_assert(I < DoCount, "no such digital output");
+            return dout.test(I);
+        }
+
+        /*
+         * <block id>!<status>!<analog in>!<analog out>!<digital in>!<digital out>*
+         * Fields the response leaves out, or cuts short, keep their
+         * previous values.
+         */
+        util::ErrorStatus decode(const char *payload, size_t len,
+                                 const eem_fields *index = nullptr)
+        {
+            EemTokenizer fields(payload, len, index);
+            std::string_view id;
+            std::string_view field;
+
+            if (!fields.next(id) || eemBlockOf(id) != Id || !fields.next(field))
+            {
+                return util::ErrorStatus::Failed;
+            }
+            if (fields.next(field))
+            {
+                decodeAnalog(field, ai);
+            }
+            if (fields.next(field))
+            {
+                decodeAnalog(field, ao);
+            }
+            if (fields.next(field))
+            {
+                di.decode(field);
+            }
+            if (fields.next(field))
+            {
+                dout.decode(field);
+            }
+            return util::ErrorStatus::Success;
+        }
+
+    private:
+        template <size_t N>
+        static void decodeAnalog(std::string_view field, std::array<float, N> &out)
+        {
+            size_t count = field.size() / EEM_HEX_DIGITS;
+
+            eem_hex_floats(field.data(), count < N ? count : N, out.data());
+        }
+};
+
+typedef EemBlock<EemBlockId::System> EemSystemBlock;
+typedef EemBlock<EemBlockId::RectifierGroup> EemRectifierGroupBlock;
+typedef EemBlock<EemBlockId::Rectifier> EemRectifierBlock;
+typedef EemBlock<EemBlockId::BatteryGroup> EemBatteryGroupBlock;
+typedef EemBlock<EemBlockId::BatteryUnit> EemBatteryUnitBlock;
+typedef EemBlock<EemBlockId::DcDistributionGroup> EemDcDistributionGroupBlock;
+typedef EemBlock<EemBlockId::EibDistributionUnit> EemEibDistributionUnitBlock;
+typedef EemBlock<EemBlockId::DcDistributionFuseUnit> EemDcDistributionFuseUnitBlock;
+typedef EemBlock<EemBlockId::BatteryFuseGroup> EemBatteryFuseGroupBlock;
+typedef EemBlock<EemBlockId::BatteryFuseUnit> EemBatteryFuseUnitBlock;
+typedef EemBlock<EemBlockId::LvdGroup> EemLvdGroupBlock;
+typedef EemBlock<EemBlockId::LvdUnit> EemLvdUnitBlock;
+typedef EemBlock<EemBlockId::AcGroup> EemAcGroupBlock;
+typedef EemBlock<EemBlockId::RectifierAc> EemRectifierAcBlock;
+typedef EemBlock<EemBlockId::ObAcUnit> EemObAcUnitBlock;
+typedef EemBlock<EemBlockId::SolarConverterGroup> EemSolarConverterGroupBlock;
+typedef EemBlock<EemBlockId::SolarConverter> EemSolarConverterBlock;
@@ -0,0 +1,62 @@
+#pragma once
+#include "util.h"
+#include "EEM.h"
+#include "ReconnectPolicy.h"
+#include <string>
+#include <memory>
+#include <istream>
+#include <unordered_map>
+
+using namespace std;
+
+/* One controller as listed in the fleet endpoint list */
+struct EemEndpoint
+{
+    string server;
+    int port;
+    string cc_id;
+
+    string key() const;
+};
+
+/*
+ * Owns every Eem session of the collector. Endpoints are registered once
+ * and sessions are created on start() and destroyed on stop(), so an idle
+ * endpoint costs one table entry and a running one a single Eem.
+ */
+class EemFleet
+{
+    public:
+        EemFleet();
+        ~EemFleet();
+
+        util::ErrorStatus loadEndpoints(const string &path);
+        util::ErrorStatus loadEndpoints(istream &in);
+        util::ErrorStatus add(const EemEndpoint &endpoint);
+        util::ErrorStatus remove(const string &key);
+
+        util::ErrorStatus start(const string &key);
+        util::ErrorStatus stop(const string &key);
+        void startAll();
+        void stopAll();
+
+        ReconnectPolicy &reconnectPolicy()
+        {
+            return reconnect;
+        }
+
+        Eem *find(const string &key) const;
+        size_t size() const
+        {
+            return endpoints.size();
+        }
+        size_t running() const
+        {
+            return sessions.size();
+        }
+
+    private:
+        unordered_map<string, EemEndpoint> endpoints;
+        unordered_map<string, unique_ptr<Eem>> sessions;
+        ReconnectPolicy reconnect;
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include "EemProto.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Fast select frame with a fixed size command:
+ *     EOT <cc_id>0000 F SOH <cc_id>0000 STX <command> END ETX BCC
+ * The skeleton, including its checksum, is rendered at compile time.
+ * Patching the cc_id or command digits later adjusts the running byte sum
+ * by the difference of the patched bytes only, so the BCC is never
+ * recomputed over the whole frame.
+ */
+template <size_t CmdLen>
+class EemSelectFrame
+{
+    public:
+        static constexpr size_t CcPos = 1;                  // after EOT
+        static constexpr size_t BccStart = 9;               // after SOH
+        static constexpr size_t CmdPos = BccStart + 7;      // after STX
+        static constexpr size_t Size = CmdPos + CmdLen + 3; // END ETX BCC
+
+        constexpr explicit EemSelectFrame(const char (&command)[CmdLen + 1]) :
+        bytes(), sum(0)
+        {
+            const char head[] = {EOT, '0', '0', '0', '0', '0', '0',
+                                 FAST_SELECT, SOH,
+                                 '0', '0', '0', '0', '0', '0', STX};
+            size_t i = 0;
+
+            for (; i < CmdPos; i++)
+            {
+                bytes[i] = head[i];
+            }
+            for (size_t j = 0; j < CmdLen; j++)
+            {
+                bytes[i++] = command[j];
+            }
+            bytes[i++] = END;
+            bytes[i++] = ETX;
+            for (size_t j = BccStart; j < i; j++)
+            {
+                sum += static_cast<uint8_t>(bytes[j]);
+            }
+            bytes[i] = static_cast<char>(bcc(sum));
+        }
+
+        static constexpr uint8_t bcc(uint8_t sum)
+        {
+            return (sum & 0x7F) < 0x20 ? (sum & 0x7F) + 0x20 : (sum & 0x7F);
+        }
+
+        constexpr void setCcId(const char *cc_id)
+        {
+            bytes[CcPos] = cc_id[0];
+            bytes[CcPos + 1] = cc_id[1];
+            patch(BccStart, cc_id[0]);
+            patch(BccStart + 1, cc_id[1]);
+        }
+
+        /* Overwrite command characters from offset on, e.g. the id of RB<id> */
+        constexpr void setArg(size_t offset, const char *arg, size_t len)
+        {
+            for (size_t i = 0; i < len && offset + i < CmdLen; i++)
+            {
+                patch(CmdPos + offset + i, arg[i]);
+            }
+        }
+
+        /* Render value as upper case hex digits from offset on */
+        constexpr void setHex(size_t offset, unsigned value, size_t digits)
+        {
+            const char hex[] = "0123456789ABCDEF";
+
+            while (digits--)
+            {
+                patch(CmdPos + offset + digits, hex[value & 0xF]);
+                value >>= 4;
+            }
+        }
+
+        const char *data() const
+        {
+            return bytes.data();
+        }
+        static constexpr size_t size()
+        {
+            return Size;
+        }
+        constexpr char checksum() const
+        {
+            return bytes[Size - 1];
+        }
+
+    private:
+        constexpr void patch(size_t pos, char c)
+        {
+            sum += static_cast<uint8_t>(c) - static_cast<uint8_t>(bytes[pos]);
+            bytes[pos] = c;
+            bytes[Size - 1] = static_cast<char>(bcc(sum));
+        }
+
+        std::array<char, Size> bytes;
+        uint8_t sum;   // 8 bit sum of bytes[BccStart .. ETX]
+};
+
+typedef EemSelectFrame<2> EemFrameRN;  // RN
+typedef EemSelectFrame<2> EemFrameRI;  // RI
+typedef EemSelectFrame<6> EemFrameRB;  // RB<id>
+typedef EemSelectFrame<4> EemFrameRC;  // RC<nn>
+
+static constexpr EemFrameRN eemFrameRN("RN");
+static constexpr EemFrameRI eemFrameRI("RI");
+static constexpr EemFrameRB eemFrameRB("RB0000");
+static constexpr EemFrameRC eemFrameRC("RC00");
+
+/* Largest fixed select frame, sizes the inline storage of a request */
+#define EEM_SELECT_MAX (EemFrameRB::Size)
+
+/* Templates render the same bytes as a frame built at run time */
+static_assert([] {
+    EemFrameRI ri = eemFrameRI;
+    ri.setCcId("01");
+    return ri.checksum() == 'k';
+}(), "RI frame template checksum");
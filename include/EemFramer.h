@@ -0,0 +1,85 @@
+#pragma once
+#include "util.h"
+#include "EemReq.h"
+#include "eem_scan.h"
+#include <cstddef>
+#include <cstdint>
+
+#define EEM_FRAME_HEADER 7 /* <cc_id><4 x '0'><STX> after SOH */
+
+enum class FramerEvent
+{
+    NeedMore,
+    Frame,
+    Ack,
+    Nak,
+    Eot,
+};
+
+/*
+ * Resumable receive state machine for one EEM session:
+ * hunt SOH/ACK/NAK/EOT -> body up to ETX -> BCC.
+ * Every byte is looked at once: eem_scan_body() finds ETX, sums the
+ * checksum and indexes the field separators of the body in the same pass,
+ * and the parser walks that index instead of the bytes. State survives
+ * across read callbacks so a frame may arrive in any number of pieces, and
+ * several frames or control bytes may arrive in one piece.
+ *
+ * A frame that lies entirely in the memory passed to one feed() call is not
+ * copied: payload() points straight into it, so that memory must stay valid
+ * until the frame has been handled. Only a frame still open when feed() runs
+ * out of data is copied into the framer, to be completed by later calls.
+ */
+class EemFramer
+{
+    public:
+        EemFramer();
+        ~EemFramer();
+
+        FramerEvent feed(const char *data, size_t len, size_t &used);
+        void reset();
+
+        /*
+         * Valid after feed() returned FramerEvent::Frame, until the next feed().
+         * The payload is not NUL terminated and the memory it lies in is never
+         * written to; use payloadLen().
+         */
+        const char *payload();
+        bool isCopied() const
+        {
+            return !view;
+        }
+        size_t payloadLen() const;
+        /* Separators of the payload, valid with payload() */
+        const eem_fields &fields() const
+        {
+            return index;
+        }
+        bool checksumOk() const;
+        uint8_t checksum() const;
+        uint8_t receivedChecksum() const;
+        size_t discarded() const
+        {
+            return skipped;
+        }
+
+    private:
+        enum class State
+        {
+            Hunt,
+            Body,
+            Bcc,
+        };
+        static uint8_t finishChecksum(uint8_t sum);
+
+        State state;
+        uint8_t sum;
+        uint8_t bcc;
+        size_t frameLen;
+        size_t skipped;
+        eem_fields index;
+        /* Frame start in the caller's memory while the frame is not copied */
+        const char *view;
+        /* Frame bytes after SOH up to and including ETX */
+        char frame[EEM_MTU];
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+/* EEM wire protocol constants */
+#define SOH 1
+#define STX 2
+#define ETX 3
+#define EOT 4
+#define ENQ 5
+#define ACK 6
+#define NAK 0x15
+#define END '*'
+#define FAST_SELECT 'F'
+#define POLL 'P'
+#define EEM_MTU 1536
+#define POLL_LEN 9
+static const char eem_ack[] = {ACK};
+static const char eem_delimit[] = {SOH, EOT, ACK, NAK, 0};
+static const char eem_field_delim[] = "!*";
@@ -5,6 +5,8 @@
 #include <event2/bufferevent.h>
 #include <vector>
 #include "EEM_parse.h"
+#include "EemProto.h"
+#include "EemFrame.h"
 #include <functional>
 
 
@@ -14,21 +16,7 @@
 #define EEM_NOBREAK(s) (*s && *s != '!' && *s != '*')
 #define EEM_STRSZ_FLOAT 8
 #define EEM_STRSZ_MAX 64
-
-#define SOH 1
-#define STX 2
-#define ETX 3
-#define EOT 4
-#define ENQ 5
-#define ACK 6
-#define NAK 0x15
-#define END '*'
-#define FAST_SELECT 'F'
-#define POLL 'P'
-#define EEM_MTU 1536
-static const char eem_ack[] = {ACK};
-static const char eem_delimit[] = {SOH, EOT, ACK, NAK, 0};
-static const char eem_field_delim[] = "!*";
+#define EEM_MAX_VALUES 100 /* Most analog values in one block */
 
 
 
@@ -71,24 +59,39 @@ class EemReq : public EemParser
 // protected:
 public:
     EemReq();
-    EemReq(EemClassReq _reqType, SelectClassCommand _selectType);
+    EemReq(EemClassReq _reqType, SelectClassCommand _selectType,
+           const std::string &_ccId = "01", const char *_blockId = "0000");
+    /* Requests are handles that live in the session queue: move only */
+    EemReq(const EemReq &) = delete;
+    EemReq &operator=(const EemReq &) = delete;
+    EemReq(EemReq &&) = default;
+    EemReq &operator=(EemReq &&) = default;
     ~EemReq();
     // friend EemParser;
-    std::vector<char> message;
+    /* Pre-rendered select frame, sent with a single write */
+    std::array<char, EEM_SELECT_MAX> message;
+    size_t messageLen;
     callReq requestType;
+    char ccId[3];
+    char blockId[5];
 
     util::ErrorStatus prepareMessage();
     util::ErrorStatus sendReq(struct bufferevent *bev);
-    std::vector<char> prepareSelect(SelectClassCommand _selectType);
+    util::ErrorStatus prepareSelect(SelectClassCommand _selectType);
     util::ErrorStatus sendPoll(struct bufferevent *bev);
-    util::ErrorStatus pickParser(char *, size_t);
+    util::ErrorStatus pickParser(const char *, size_t, const eem_fields * = nullptr);
     int callParser(char *, size_t);
 
+    /* A read that would put the same frame on the wire as other */
+    bool sameRead(const EemReq &other) const;
+
     util::ErrorStatus sendACK(struct bufferevent *bev);
     
-    std::string getSelectType(SelectClassCommand selectType);
     void cleanBufferevent();
     uint8_t getCheksum(const void *, size_t);
 
+private:
+    template <size_t CmdLen>
+    void render(const EemSelectFrame<CmdLen> &frameTemplate);
 };
 
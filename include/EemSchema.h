@@ -0,0 +1,454 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include "eem_blocks.h"
+
+/*
+ * Layout of the EEM blocks known at compile time: the number of analog and
+ * digital values in the RB response of each block, and their names. Both
+ * come from the lists of eem_blocks.h, as do those of eem_blocks[] in the C
+ * engine (eem_parse.c). EemBlock<Id> (EemBlock.h) sizes its storage from
+ * these counts.
+ */
+
+/* Same order as eemid_t and eem_codes[] */
+enum class EemBlockId : uint8_t
+{
+    System,
+    RectifierGroup,
+    Rectifier,
+    BatteryGroup,
+    BatteryUnit,
+    DcDistributionGroup,
+    EibDistributionUnit,
+    DcDistributionFuseUnit,
+    BatteryFuseGroup,
+    BatteryFuseUnit,
+    LvdGroup,
+    LvdUnit,
+    AcGroup,
+    RectifierAc,
+    ObAcUnit,
+    SolarConverterGroup,
+    SolarConverter,
+    SmIoIb2,
+    Unknown
+};
+
+#define EEM_BLOCK_TYPES (static_cast<size_t>(EemBlockId::Unknown))
+
+struct EemBlockSchema
+{
+    const char *name;
+    const char *code;   // ID prefix as in eem_codes[], '.' matches any digit
+    uint8_t aiCount;
+    uint8_t aoCount;
+    uint8_t diCount;
+    uint8_t doCount;
+    const char *const *aiNames;
+    const char *const *aoNames;
+    const char *const *diNames;
+    const char *const *doNames;
+
+    /*
+     * Index of a value by name, the first one when names repeat. Meant for
+     * constant expressions, where an unknown name fails the build.
+     */
+    constexpr size_t ai(std::string_view n) const
+    {
+        return indexOf(aiNames, aiCount, n);
+    }
+    constexpr size_t ao(std::string_view n) const
+    {
+        return indexOf(aoNames, aoCount, n);
+    }
+    constexpr size_t di(std::string_view n) const
+    {
+        return indexOf(diNames, diCount, n);
+    }
+    constexpr size_t dout(std::string_view n) const
+    {
+        return indexOf(doNames, doCount, n);
+    }
+
+    static constexpr size_t indexOf(const char *const *names, size_t count,
+                                    std::string_view n)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (n == names[i])
+            {
+                return i;
+            }
+        }
+        throw std::out_of_range("no such EEM value");
+    }
+};
+
+static constexpr const char *eemNoNames[] = {nullptr};
+
+static constexpr const char *eemSystemAi[] = {
+    EEM_SYSTEM_AI(EEM_NAME)
+};
+static constexpr const char *eemSystemAo[] = {
+    EEM_SYSTEM_AO(EEM_NAME)
+};
+static constexpr const char *eemSystemDi[] = {
+    EEM_SYSTEM_DI(EEM_NAME)
+};
+static constexpr const char *eemSystemDo[] = {
+    EEM_SYSTEM_DO(EEM_NAME)
+};
+
+static constexpr const char *eemRectifierGroupAi[] = {
+    EEM_RECTIFIER_GROUP_AI(EEM_NAME)
+};
+static constexpr const char *eemRectifierGroupAo[] = {
+    EEM_RECTIFIER_GROUP_AO(EEM_NAME)
+};
+static constexpr const char *eemRectifierGroupDi[] = {
+    EEM_RECTIFIER_GROUP_DI(EEM_NAME)
+};
+static constexpr const char *eemRectifierGroupDo[] = {
+    EEM_RECTIFIER_GROUP_DO(EEM_NAME)
+};
+
+static constexpr const char *eemRectifierAi[] = {
+    EEM_RECTIFIER_AI(EEM_NAME)
+};
+static constexpr const char *eemRectifierAo[] = {
+    EEM_RECTIFIER_AO(EEM_NAME)
+};
+static constexpr const char *eemRectifierDi[] = {
+    EEM_RECTIFIER_DI(EEM_NAME)
+};
+static constexpr const char *eemRectifierDo[] = {
+    EEM_RECTIFIER_DO(EEM_NAME)
+};
+
+static constexpr const char *eemBatteryGroupAi[] = {
+    EEM_BATTERY_GROUP_AI(EEM_NAME)
+};
+static constexpr const char *eemBatteryGroupAo[] = {
+    EEM_BATTERY_GROUP_AO(EEM_NAME)
+};
+static constexpr const char *eemBatteryGroupDi[] = {
+    EEM_BATTERY_GROUP_DI(EEM_NAME)
+};
+static constexpr const char *eemBatteryGroupDo[] = {
+    EEM_BATTERY_GROUP_DO(EEM_NAME)
+};
+
+static constexpr const char *eemBatteryUnitAi[] = {
+    EEM_BATTERY_UNIT_AI(EEM_NAME)
+};
+static constexpr const char *eemBatteryUnitAo[] = {
+    EEM_BATTERY_UNIT_AO(EEM_NAME)
+};
+static constexpr const char *eemBatteryUnitDi[] = {
+    EEM_BATTERY_UNIT_DI(EEM_NAME)
+};
+
+static constexpr const char *eemDcDistributionGroupAi[] = {
+    EEM_DC_DISTRIBUTION_GROUP_AI(EEM_NAME)
+};
+
+static constexpr const char *eemEibDistributionUnitAi[] = {
+    EEM_EIB_DISTRIBUTION_UNIT_AI(EEM_NAME)
+};
+
+static constexpr const char *eemDcDistributionFuseUnitAi[] = {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_AI(EEM_NAME)
+};
+static constexpr const char *eemDcDistributionFuseUnitDi[] = {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DI(EEM_NAME)
+};
+static constexpr const char *eemDcDistributionFuseUnitDo[] = {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DO(EEM_NAME)
+};
+
+static constexpr const char *eemBatteryFuseGroupAi[] = {
+    EEM_BATTERY_FUSE_GROUP_AI(EEM_NAME)
+};
+
+static constexpr const char *eemBatteryFuseUnitAi[] = {
+    EEM_BATTERY_FUSE_UNIT_AI(EEM_NAME)
+};
+static constexpr const char *eemBatteryFuseUnitDi[] = {
+    EEM_BATTERY_FUSE_UNIT_DI(EEM_NAME)
+};
+
+static constexpr const char *eemLvdGroupAo[] = {
+    EEM_LVD_GROUP_AO(EEM_NAME)
+};
+static constexpr const char *eemLvdGroupDi[] = {
+    EEM_LVD_GROUP_DI(EEM_NAME)
+};
+static constexpr const char *eemLvdGroupDo[] = {
+    EEM_LVD_GROUP_DO(EEM_NAME)
+};
+
+static constexpr const char *eemLvdUnitAo[] = {
+    EEM_LVD_UNIT_AO(EEM_NAME)
+};
+static constexpr const char *eemLvdUnitDi[] = {
+    EEM_LVD_UNIT_DI(EEM_NAME)
+};
+static constexpr const char *eemLvdUnitDo[] = {
+    EEM_LVD_UNIT_DO(EEM_NAME)
+};
+
+static constexpr const char *eemAcGroupAi[] = {
+    EEM_AC_GROUP_AI(EEM_NAME)
+};
+
+static constexpr const char *eemRectifierAcAi[] = {
+    EEM_RECTIFIER_AC_AI(EEM_NAME)
+};
+static constexpr const char *eemRectifierAcAo[] = {
+    EEM_RECTIFIER_AC_AO(EEM_NAME)
+};
+static constexpr const char *eemRectifierAcDi[] = {
+    EEM_RECTIFIER_AC_DI(EEM_NAME)
+};
+static constexpr const char *eemRectifierAcDo[] = {
+    EEM_RECTIFIER_AC_DO(EEM_NAME)
+};
+
+static constexpr const char *eemObAcUnitAi[] = {
+    EEM_OB_AC_UNIT_AI(EEM_NAME)
+};
+static constexpr const char *eemObAcUnitAo[] = {
+    EEM_OB_AC_UNIT_AO(EEM_NAME)
+};
+static constexpr const char *eemObAcUnitDi[] = {
+    EEM_OB_AC_UNIT_DI(EEM_NAME)
+};
+static constexpr const char *eemObAcUnitDo[] = {
+    EEM_OB_AC_UNIT_DO(EEM_NAME)
+};
+
+static constexpr const char *eemSolarConverterGroupAi[] = {
+    EEM_SOLAR_CONVERTER_GROUP_AI(EEM_NAME)
+};
+static constexpr const char *eemSolarConverterGroupDi[] = {
+    EEM_SOLAR_CONVERTER_GROUP_DI(EEM_NAME)
+};
+static constexpr const char *eemSolarConverterGroupDo[] = {
+    EEM_SOLAR_CONVERTER_GROUP_DO(EEM_NAME)
+};
+
+static constexpr const char *eemSolarConverterAi[] = {
+    EEM_SOLAR_CONVERTER_AI(EEM_NAME)
+};
+static constexpr const char *eemSolarConverterDi[] = {
+    EEM_SOLAR_CONVERTER_DI(EEM_NAME)
+};
+static constexpr const char *eemSolarConverterDo[] = {
+    EEM_SOLAR_CONVERTER_DO(EEM_NAME)
+};
+
+static constexpr EemBlockSchema eemBlockSchemas[EEM_BLOCK_TYPES] = {
+    {"System", "0000",
+     EEM_SYSTEM_AI_COUNT, EEM_SYSTEM_AO_COUNT,
+     EEM_SYSTEM_DI_COUNT, EEM_SYSTEM_DO_COUNT,
+     eemSystemAi, eemSystemAo, eemSystemDi, eemSystemDo},
+    {"Rectifier Group", "0200",
+     EEM_RECTIFIER_GROUP_AI_COUNT, EEM_RECTIFIER_GROUP_AO_COUNT,
+     EEM_RECTIFIER_GROUP_DI_COUNT, EEM_RECTIFIER_GROUP_DO_COUNT,
+     eemRectifierGroupAi, eemRectifierGroupAo, eemRectifierGroupDi, eemRectifierGroupDo},
+    {"Rectifier", "02",
+     EEM_RECTIFIER_AI_COUNT, EEM_RECTIFIER_AO_COUNT,
+     EEM_RECTIFIER_DI_COUNT, EEM_RECTIFIER_DO_COUNT,
+     eemRectifierAi, eemRectifierAo, eemRectifierDi, eemRectifierDo},
+    {"Battery Group", "0300",
+     EEM_BATTERY_GROUP_AI_COUNT, EEM_BATTERY_GROUP_AO_COUNT,
+     EEM_BATTERY_GROUP_DI_COUNT, EEM_BATTERY_GROUP_DO_COUNT,
+     eemBatteryGroupAi, eemBatteryGroupAo, eemBatteryGroupDi, eemBatteryGroupDo},
+    {"Battery Unit", "03",
+     EEM_BATTERY_UNIT_AI_COUNT, EEM_BATTERY_UNIT_AO_COUNT,
+     EEM_BATTERY_UNIT_DI_COUNT, 0,
+     eemBatteryUnitAi, eemBatteryUnitAo, eemBatteryUnitDi, eemNoNames},
+    {"DC Distribution Group", "0400",
+     EEM_DC_DISTRIBUTION_GROUP_AI_COUNT, 0, 0, 0,
+     eemDcDistributionGroupAi, eemNoNames, eemNoNames, eemNoNames},
+    {"EIB Distribution Unit", "040.4",
+     EEM_EIB_DISTRIBUTION_UNIT_AI_COUNT, 0, 0, 0,
+     eemEibDistributionUnitAi, eemNoNames, eemNoNames, eemNoNames},
+    {"DC Distribution Fuse Unit", "04",
+     EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_COUNT, 0,
+     EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_COUNT, EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_COUNT,
+     eemDcDistributionFuseUnitAi, eemNoNames, eemDcDistributionFuseUnitDi, eemDcDistributionFuseUnitDo},
+    {"Battery Fuse Group", "0500",
+     EEM_BATTERY_FUSE_GROUP_AI_COUNT, 0, 0, 0,
+     eemBatteryFuseGroupAi, eemNoNames, eemNoNames, eemNoNames},
+    {"Battery Fuse Unit", "05",
+     EEM_BATTERY_FUSE_UNIT_AI_COUNT, 0, EEM_BATTERY_FUSE_UNIT_DI_COUNT, 0,
+     eemBatteryFuseUnitAi, eemNoNames, eemBatteryFuseUnitDi, eemNoNames},
+    {"LVD Group", "0700",
+     0, EEM_LVD_GROUP_AO_COUNT, EEM_LVD_GROUP_DI_COUNT, EEM_LVD_GROUP_DO_COUNT,
+     eemNoNames, eemLvdGroupAo, eemLvdGroupDi, eemLvdGroupDo},
+    {"LVD Unit", "07",
+     0, EEM_LVD_UNIT_AO_COUNT, EEM_LVD_UNIT_DI_COUNT, EEM_LVD_UNIT_DO_COUNT,
+     eemNoNames, eemLvdUnitAo, eemLvdUnitDi, eemLvdUnitDo},
+    {"AC Group", "0900",
+     EEM_AC_GROUP_AI_COUNT, 0, 0, 0,
+     eemAcGroupAi, eemNoNames, eemNoNames, eemNoNames},
+    {"Rectifier AC", "0901",
+     EEM_RECTIFIER_AC_AI_COUNT, EEM_RECTIFIER_AC_AO_COUNT,
+     EEM_RECTIFIER_AC_DI_COUNT, EEM_RECTIFIER_AC_DO_COUNT,
+     eemRectifierAcAi, eemRectifierAcAo, eemRectifierAcDi, eemRectifierAcDo},
+    {"OB AC Unit", "0902",
+     EEM_OB_AC_UNIT_AI_COUNT, EEM_OB_AC_UNIT_AO_COUNT,
+     EEM_OB_AC_UNIT_DI_COUNT, EEM_OB_AC_UNIT_DO_COUNT,
+     eemObAcUnitAi, eemObAcUnitAo, eemObAcUnitDi, eemObAcUnitDo},
+    {"Solar Converter Group", "2600",
+     EEM_SOLAR_CONVERTER_GROUP_AI_COUNT, 0,
+     EEM_SOLAR_CONVERTER_GROUP_DI_COUNT, EEM_SOLAR_CONVERTER_GROUP_DO_COUNT,
+     eemSolarConverterGroupAi, eemNoNames, eemSolarConverterGroupDi, eemSolarConverterGroupDo},
+    {"Solar Converter", "26",
+     EEM_SOLAR_CONVERTER_AI_COUNT, 0,
+     EEM_SOLAR_CONVERTER_DI_COUNT, EEM_SOLAR_CONVERTER_DO_COUNT,
+     eemSolarConverterAi, eemNoNames, eemSolarConverterDi, eemSolarConverterDo},
+    /* Classified by eem_getid() but without a layout in eem_blocks[] */
+    {"EIB Digital Inputs", "5F0.3",
+     0, 0, 0, 0,
+     eemNoNames, eemNoNames, eemNoNames, eemNoNames},
+};
+
+static constexpr const EemBlockSchema &
+eemSchema(EemBlockId id)
+{
+    return eemBlockSchemas[static_cast<size_t>(id)];
+}
+
+/* Whether a count and its names are those of list, eemNoNames for none */
+template <size_t N>
+static constexpr bool
+eemNamesMatch(size_t count, const char *const *names,
+              const char *const (&list)[N])
+{
+    return names == list && count == (list[0] ? N : 0);
+}
+
+/* Whether each count of block id is the size of its name array */
+template <size_t A, size_t B, size_t C, size_t D>
+static constexpr bool
+eemSchemaMatches(EemBlockId id, const char *const (&ai)[A],
+                 const char *const (&ao)[B], const char *const (&di)[C],
+                 const char *const (&dout)[D])
+{
+    const EemBlockSchema &s = eemSchema(id);
+
+    return eemNamesMatch(s.aiCount, s.aiNames, ai)
+        && eemNamesMatch(s.aoCount, s.aoNames, ao)
+        && eemNamesMatch(s.diCount, s.diNames, di)
+        && eemNamesMatch(s.doCount, s.doNames, dout);
+}
+
+static_assert(eemSchemaMatches(EemBlockId::System, eemSystemAi, eemSystemAo,
+                               eemSystemDi, eemSystemDo),
+              "EEM System counts");
+static_assert(eemSchemaMatches(EemBlockId::RectifierGroup,
+                               eemRectifierGroupAi, eemRectifierGroupAo,
+                               eemRectifierGroupDi, eemRectifierGroupDo),
+              "EEM Rectifier Group counts");
+static_assert(eemSchemaMatches(EemBlockId::Rectifier, eemRectifierAi,
+                               eemRectifierAo, eemRectifierDi, eemRectifierDo),
+              "EEM Rectifier counts");
+static_assert(eemSchemaMatches(EemBlockId::BatteryGroup, eemBatteryGroupAi,
+                               eemBatteryGroupAo, eemBatteryGroupDi,
+                               eemBatteryGroupDo),
+              "EEM Battery Group counts");
+static_assert(eemSchemaMatches(EemBlockId::BatteryUnit, eemBatteryUnitAi,
+                               eemBatteryUnitAo, eemBatteryUnitDi, eemNoNames),
+              "EEM Battery Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::DcDistributionGroup,
+                               eemDcDistributionGroupAi, eemNoNames,
+                               eemNoNames, eemNoNames),
+              "EEM DC Distribution Group counts");
+static_assert(eemSchemaMatches(EemBlockId::EibDistributionUnit,
+                               eemEibDistributionUnitAi, eemNoNames,
+                               eemNoNames, eemNoNames),
+              "EEM EIB Distribution Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::DcDistributionFuseUnit,
+                               eemDcDistributionFuseUnitAi, eemNoNames,
+                               eemDcDistributionFuseUnitDi,
+                               eemDcDistributionFuseUnitDo),
+              "EEM DC Distribution Fuse Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::BatteryFuseGroup,
+                               eemBatteryFuseGroupAi, eemNoNames, eemNoNames,
+                               eemNoNames),
+              "EEM Battery Fuse Group counts");
+static_assert(eemSchemaMatches(EemBlockId::BatteryFuseUnit,
+                               eemBatteryFuseUnitAi, eemNoNames,
+                               eemBatteryFuseUnitDi, eemNoNames),
+              "EEM Battery Fuse Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::LvdGroup, eemNoNames, eemLvdGroupAo,
+                               eemLvdGroupDi, eemLvdGroupDo),
+              "EEM LVD Group counts");
+static_assert(eemSchemaMatches(EemBlockId::LvdUnit, eemNoNames, eemLvdUnitAo,
+                               eemLvdUnitDi, eemLvdUnitDo),
+              "EEM LVD Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::AcGroup, eemAcGroupAi, eemNoNames,
+                               eemNoNames, eemNoNames),
+              "EEM AC Group counts");
+static_assert(eemSchemaMatches(EemBlockId::RectifierAc, eemRectifierAcAi,
+                               eemRectifierAcAo, eemRectifierAcDi,
+                               eemRectifierAcDo),
+              "EEM Rectifier AC counts");
+static_assert(eemSchemaMatches(EemBlockId::ObAcUnit, eemObAcUnitAi,
+                               eemObAcUnitAo, eemObAcUnitDi, eemObAcUnitDo),
+              "EEM OB AC Unit counts");
+static_assert(eemSchemaMatches(EemBlockId::SolarConverterGroup,
+                               eemSolarConverterGroupAi, eemNoNames,
+                               eemSolarConverterGroupDi,
+                               eemSolarConverterGroupDo),
+              "EEM Solar Converter Group counts");
+static_assert(eemSchemaMatches(EemBlockId::SolarConverter,
+                               eemSolarConverterAi, eemNoNames,
+                               eemSolarConverterDi, eemSolarConverterDo),
+              "EEM Solar Converter counts");
+static_assert(eemSchemaMatches(EemBlockId::SmIoIb2, eemNoNames, eemNoNames,
+                               eemNoNames, eemNoNames),
+              "EEM Digital Inputs counts");
+
+/* Whether id starts with code, as eem_getid() matches eem_codes[] */
+static constexpr bool
+eemCodeMatch(std::string_view code, std::string_view id)
+{
+    if (id.size() < code.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < code.size(); i++)
+    {
+        if (code[i] != '.' && code[i] != id[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Block type of a device ID, the first schema whose code matches */
+static constexpr EemBlockId
+eemBlockOf(std::string_view id)
+{
+    size_t i = 0;
+
+    while (i < EEM_BLOCK_TYPES && !eemCodeMatch(eemBlockSchemas[i].code, id))
+    {
+        i++;
+    }
+    return static_cast<EemBlockId>(i);
+}
+
+static_assert(eemBlockOf("0000") == EemBlockId::System, "EEM block codes");
+static_assert(eemBlockOf("0203") == EemBlockId::Rectifier, "EEM block codes");
+static_assert(eemBlockOf("04014") == EemBlockId::EibDistributionUnit,
+              "EEM block codes");
+static_assert(eemBlockOf("5F003") == EemBlockId::SmIoIb2, "EEM block codes");
+static_assert(eemBlockOf("FFFF") == EemBlockId::Unknown, "EEM block codes");
@@ -0,0 +1,95 @@
+#pragma once
+#include "EemProto.h"
+#include "eem_scan.h"
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+#define EEM_SUBFIELD '#'
+
+/*
+ * Splits a framed response payload into fields on '!', '#' and END in a
+ * single pass. Fields are views into the payload, which is neither copied
+ * nor written to, so it may still be evbuffer memory. Nothing past len or
+ * past END is looked at; the payload need not be NUL terminated.
+ * Given the separator index the framer built while receiving the payload,
+ * fields are cut at the indexed offsets without reading the bytes again.
+ */
+class EemTokenizer
+{
+    public:
+        EemTokenizer(const char *data, size_t len,
+                     const eem_fields *_index = nullptr) :
+        text(data, data ? len : 0), pos(0), delim('\0'), finished(!data || !len),
+        index(_index), cursor(0)
+        {}
+
+        /* Next field; false once END or the end of the payload was passed */
+        bool next(std::string_view &field)
+        {
+            size_t start = pos;
+
+            if (finished)
+            {
+                return false;
+            }
+            pos = findDelimiter(start);
+            field = text.substr(start, pos - start);
+            delim = pos < text.size() ? text[pos++] : '\0';
+            finished = delim == END || delim == '\0';
+            return true;
+        }
+
+        /* What ended the last field: '!', '#', END, or NUL at the end */
+        char delimiter() const
+        {
+            return delim;
+        }
+        bool done() const
+        {
+            return finished;
+        }
+        /* Payload not yet split */
+        std::string_view rest() const
+        {
+            return text.substr(pos);
+        }
+
+        static constexpr bool isDelimiter(char c)
+        {
+            return c == '!' || c == END || c == EEM_SUBFIELD;
+        }
+
+    private:
+        size_t findDelimiter(size_t from)
+        {
+            if (index)
+            {
+                while (cursor < index->count && index->at[cursor] < from)
+                {
+                    cursor++;
+                }
+                if (cursor < index->count)
+                {
+                    return std::min<size_t>(index->at[cursor], text.size());
+                }
+                if (!index->overflow)
+                {
+                    return text.size();
+                }
+                /* Past the end of a partial index, look for ourselves */
+            }
+            while (from < text.size() && !isDelimiter(text[from]))
+            {
+                from++;
+            }
+            return from;
+        }
+
+        std::string_view text;
+        size_t pos;
+        char delim;
+        bool finished;
+        const eem_fields *index;
+        uint16_t cursor;
+};
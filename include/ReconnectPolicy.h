@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+
+/*
+ * Reconnect pacing shared by the sessions of a fleet. A session that lost
+ * its controller waits a random time between zero and an exponentially
+ * growing cap (full jitter), and every connect attempt of the fleet takes a
+ * token from one bucket, so a site-wide flap is spread out instead of
+ * hitting the loops and terminal servers at the same instant.
+ * Shards call in from their own threads, the bucket is locked.
+ */
+class ReconnectPolicy
+{
+    public:
+        ReconnectPolicy(uint32_t _baseMs = 1000, uint32_t _maxMs = 60000,
+                        uint32_t _connectsPerSec = 50, uint32_t _burst = 100);
+
+        /* Delay before reconnect attempt number `attempt`, counted from 0 */
+        uint32_t backoffMs(unsigned attempt);
+        /* Take a connect token; on refusal waitMs says when to try again */
+        bool acquire(uint32_t &waitMs);
+        /* Upper bound on the time for `sessions` lost sessions to reconnect */
+        uint64_t recoveryBoundMs(size_t sessions) const;
+
+    private:
+        uint32_t random(uint32_t max);
+
+        uint32_t baseMs;
+        uint32_t maxMs;
+        uint32_t connectsPerSec;
+        uint32_t burst;
+        std::mutex lock;
+        uint64_t stampMs;
+        uint64_t millitokens;   // tokens * 1000
+        std::minstd_rand rng;
+};
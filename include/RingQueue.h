@@ -0,0 +1,85 @@
+#pragma once
+#include "util.h"
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/*
+ * Bounded FIFO over a fixed array. Push and pop are O(1) and move the
+ * element; nothing is allocated after construction. push() refuses new
+ * elements once Capacity is reached so producers see backpressure.
+ */
+template <typename T, size_t Capacity>
+class RingQueue
+{
+    static_assert(Capacity && !(Capacity & (Capacity - 1)),
+                  "RingQueue capacity must be a power of two");
+
+    public:
+        RingQueue() : head(0), count(0)
+        {}
+
+        util::ErrorStatus push(T &&item)
+        {
+            if (count == Capacity)
+            {
+                return util::ErrorStatus::Failed;
+            }
+            slots[(head + count) & (Capacity - 1)] = std::move(item);
+            count++;
+            return util::ErrorStatus::Success;
+        }
+
+        T &front()
+        {
+            return slots[head];
+        }
+
+        void pop()
+        {
+            head = (head + 1) & (Capacity - 1);
+            count--;
+        }
+
+        void clear()
+        {
+            head = 0;
+            count = 0;
+        }
+
+        /* Whether some queued element, front included, satisfies pred */
+        template <typename Pred>
+        bool any(Pred pred) const
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (pred(slots[(head + i) & (Capacity - 1)]))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool empty() const
+        {
+            return !count;
+        }
+        bool full() const
+        {
+            return count == Capacity;
+        }
+        size_t size() const
+        {
+            return count;
+        }
+        static constexpr size_t capacity()
+        {
+            return Capacity;
+        }
+
+    private:
+        std::array<T, Capacity> slots;
+        size_t head;
+        size_t count;
+};
@@ -1,23 +1,43 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
 #include <sys/socket.h>
 #include <event.h>
 #include <iostream>
 
+/*
+ * Loop-per-core runtime. Every shard owns one event_base driven by its own
+ * worker thread; a session is pinned to a shard for its whole lifetime so
+ * its sockets, timers and parser state are only ever touched by one thread.
+ * Shard 0 doubles as the legacy single base returned by get_baseEvent().
+ */
 class baseEvent
 {
     private:
         static struct event_base *ev_base;
         static std::string nameOfBase;
+        static std::vector<struct event_base *> shards;
+        static std::vector<std::thread> workers;
+        static std::atomic<bool> running;
 
+        static void worker(struct event_base *base);
 
     public:
         baseEvent();
         ~baseEvent();
-        static void initBase();
+        static void initBase(size_t numShards = 1);
         static void dispatch_event();
+        static void stop();
         static struct event_base* get_baseEvent();
+        static struct event_base* get_baseEvent(size_t shard);
+        static size_t shardCount();
+        static size_t shardOf(const std::string &key);
+        static void runInLoop(struct event_base *base,
+                              void (*cb)(evutil_socket_t, short, void *),
+                              void *arg);
         static std::string get_name();
         
 
-};
\ No newline at end of file
+};
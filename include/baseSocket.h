@@ -26,12 +26,14 @@ class SocketBase
 
         int fd;
         struct bufferevent *bev;
+        struct event_base *base;
 
     public:
         struct sockaddr_in *sin;
         socketUtil::BevStatus baseSocketConnected;
 
-        SocketBase(string _server, int _port);
+        SocketBase(string _server, int _port,
+                   struct event_base *_base = baseEvent::get_baseEvent());
         SocketBase(){};
         ~SocketBase();
         int getFd();
@@ -57,6 +59,10 @@ class SocketBase
         {
             return bev;
         }
+        struct event_base* getBase() const
+        {
+            return base;
+        }
 
 
 };
@@ -5,12 +5,17 @@
  */
 
 #define _GNU_SOURCE
+/* Bytes eem_rx_feed() finds outside any frame go to the debug dump */
+#define eem_rx_discard(p, n) dump("EEM?>", p, n)
 #include "config.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <errno.h>
+#include <time.h>
 #include <assert.h>
 #include <alloca.h>
 #include <math.h>
@@ -35,6 +40,8 @@
 #include "pwr.h"
 #include "eem.h"
 #include "eem_parse.h"
+#include "eem_scan.h"
+#include "eem_hex.h"
 #include "PowerSystem_func.h"
 #include "BatteryProfile_func.h"
 #include "Threshold_func.h"
@@ -72,13 +79,26 @@ static const char *eem_threshold_alarmentry_update(MO_instance *ins, void *arg U
 static void eem_create_system_thresholds(struct pwr *);
 
 static void eemdev_read_next(struct pwr *, struct eemdev *);
+static void eem_wb_flush(int, short, void *);
+static void eem_inventory_save(struct pwr *);
 void eem_set_undervolt(struct pwr *, port_t, float);
 void eem_check_undervolt(struct pwr *, port_t, float);
 
 static const char eem_ack[] = {ACK};
-static const char eem_delimit[] = {SOH, EOT, ACK, NAK, 0};
 static const char eem_field_delim[] = "!*";
 
+/* Writes to one block merged until the next flush, last writer wins */
+struct eem_wb {
+    struct eem_wb *next;	/* Older flushed write of the block */
+    struct eemdev *ed;		/* Block, set when flushed */
+    size_t na;			/* Analog outputs to send, 0 for none */
+    size_t nd;			/* Digital outputs to send, 0 for none */
+    eem_bits_t ao_set;		/* Analog outputs written */
+    eem_bits_t do_set;		/* Digital outputs written */
+    eem_bits_t dout;		/* Values of the digital outputs written */
+    float ao[EEM_MAX_AO];	/* Values of the analog outputs written */
+};
+
 struct eemdev {
     struct list_head list;
     struct list_head phy;
@@ -88,6 +108,16 @@ struct eemdev {
     char id[IDLEN];
     char name[NAMELEN];
     struct eemdata data;
+    char *raw;			/* Value fields of the last RB reply, for eemdev_decode() */
+    size_t raw_size;
+    struct eem_wb *wb;		/* Writes waiting for eem_wb_flush() */
+    struct eem_wb *wb_sent;	/* Flushed writes not yet read back, newest first */
+    uint32_t poll_ms;		/* Own read interval, or EEM_POLL_CLASS */
+    uint64_t next_poll;		/* eem_now_ms() from which a read is due */
+    bool cached;		/* From the inventory cache, not in an RI reply yet */
+    uint32_t ri_gen;		/* RI scan that last listed it, 0 for none */
+    uint64_t status_hash;	/* Of the status register in the last RB reply */
+    bool stale;			/* Cached, but gone from the RI reply; not read */
     eemid_t eemid;
 };
 
@@ -102,8 +132,8 @@ struct PACKED eem_alarm {
 
 // Index constants for EEM parameters in the Analogue Output (ao) of the EEM battery group
 enum eem_battey_ao_index{
-	IDX_EEM_USED_CAPACITY_LIMIT = 19,
-	IDX_EEM_BATTERY_TEST_TIME   = 22,
+	IDX_EEM_USED_CAPACITY_LIMIT = EEM_BATTERY_GROUP_AO_USED_CAPACITY_LIMIT,
+	IDX_EEM_BATTERY_TEST_TIME   = EEM_BATTERY_GROUP_AO_BATTERY_TEST_TIME,
 };
 
 #define SYSTEM_AE_PROTOCOL_EXT_ALARM_OFFSET 6
@@ -431,11 +461,22 @@ eem_checksum(const void *buf, size_t len)
     while (len--) {
 	sum += *p++;
     }
-    sum &= 0x7F;
-    if (sum < 0x20) {
-	sum += 0x20;
+    return eem_bcc(sum);
+}
+
+#define EEM_FNV_INIT 0xCBF29CE484222325ull
+
+/**
+ * @brief FNV-1a hash of n bytes, continuing from h (EEM_FNV_INIT to start)
+ */
+static uint64_t
+eem_fnv(uint64_t h, const void *buf, size_t n)
+{
+    const uint8_t *p = buf;
+    while (n--) {
+	h = (h ^ *p++) * 0x100000001B3ull;
     }
-    return sum;
+    return h;
 }
 
 /**
@@ -445,7 +486,13 @@ eem_checksum(const void *buf, size_t len)
 static void
 eemr_free(struct eemr *er)
 {
+    struct eemr_waiter *w;
+    while ((w = er->waiters)) {
+	er->waiters = w->next;
+	free(w);
+    }
     list_del(&er->list);
+    er->eem->queue_len--;
     free(er);
 }
 
@@ -459,6 +506,397 @@ eemr_first(struct eem *e)
     return list_entry(head->next, struct eemr, list);
 }
 
+/* Seconds a request of each class may wait before it is sent out of turn */
+static const time_t eem_prio_deadline[EEM_PRIO_CLASSES] = {
+    [EEM_PRIO_CONTROL] = 1,
+    [EEM_PRIO_ALARM] = 5,
+    [EEM_PRIO_TELEMETRY] = 30,
+    [EEM_PRIO_INVENTORY] = 120,
+};
+
+/**
+ * @brief Classify a request by its command
+ * @param request	Request data, NULL for a queue checkpoint
+ * @return		Scheduling class of the request
+ */
+static eem_prio_t
+eemr_prio(const char *request)
+{
+    if (!request || !*request) {
+	return EEM_PRIO_INVENTORY;
+    }
+    if (!strncmp(request, "RC", 2)) {
+	return EEM_PRIO_ALARM;
+    }
+    if (!strncmp(request, "RB", 2)) {
+	return EEM_PRIO_TELEMETRY;
+    }
+    if (!strncmp(request, "RI", 2) || !strncmp(request, "RN", 2)
+	|| !strncmp(request, "RP", 2) || !strncmp(request, "DL", 2)
+	|| !strncmp(request, "DP", 2)) {
+	return EEM_PRIO_INVENTORY;
+    }
+    /* WB and anything an operator sent by hand */
+    return EEM_PRIO_CONTROL;
+}
+
+static const char eem_cmd_name[EEM_CMD_TYPES][3] = {
+    [EEM_CMD_RB] = "RB",
+    [EEM_CMD_RC] = "RC",
+    [EEM_CMD_RI] = "RI",
+    [EEM_CMD_RN] = "RN",
+    [EEM_CMD_RP] = "RP",
+    [EEM_CMD_DL] = "DL",
+    [EEM_CMD_DP] = "DP",
+    [EEM_CMD_WB] = "WB",
+    [EEM_CMD_OTHER] = "--",
+};
+
+/**
+ * @brief Classify a request by its command for round trip timing
+ * @param request	Request data, NULL for a queue checkpoint
+ * @return		Command of the request
+ */
+static eem_cmd_t
+eemr_cmd(const char *request)
+{
+    eem_cmd_t cmd;
+    if (!request) {
+	return EEM_CMD_OTHER;
+    }
+    for (cmd = 0; cmd < EEM_CMD_OTHER; cmd++) {
+	if (!strncmp(request, eem_cmd_name[cmd], 2)) {
+	    return cmd;
+	}
+    }
+    return EEM_CMD_OTHER;
+}
+
+/**
+ * @brief Key under which identical requests share one transaction
+ * @param request	Request data
+ * @param request_len	Length of request data
+ * @return		The command packed into 64 bits, 0 for a request that
+ *			must go out on its own: writes, hand made commands
+ *			other than reads, checkpoints
+ */
+static uint64_t
+eemr_key(const char *request, size_t request_len)
+{
+    static const char reads[][3] = {"RB", "RC", "RI", "RN", "RP", "DL", "DP"};
+    uint64_t key = 0;
+    size_t i;
+    if (request_len < 2 || request_len > sizeof key) {
+	return 0;
+    }
+    for (i = 0; i < MAXCOUNT(reads); i++) {
+	if (!strncmp(request, reads[i], 2)) {
+	    break;
+	}
+    }
+    if (i == MAXCOUNT(reads)) {
+	return 0;
+    }
+    memcpy(&key, request, request_len);
+    return key;
+}
+
+/**
+ * @brief Let a request ride on a queued or in-flight one with the same key
+ * @return	The request joined, NULL when there is none
+ *
+ * A callback already waiting with the same argument is not added twice,
+ * so overlapping pollers do not each get to handle the reply.
+ */
+static struct eemr *
+eemr_join(struct eem *e, uint64_t key, eem_callback_t *callback, void *arg)
+{
+    struct eemr *er;
+    struct eemr_waiter *w;
+    struct eemr_waiter **tail;
+    list_for_each_entry (er, &e->queue, list) {
+	if (er->key != key) {
+	    continue;
+	}
+	if (er->user_callback == callback && er->user_data == arg) {
+	    return er;
+	}
+	for (tail = &er->waiters; (w = *tail); tail = &w->next) {
+	    if (w->callback == callback && w->arg == arg) {
+		return er;
+	    }
+	}
+	if (!(w = malloc(sizeof *w))) {
+	    return NULL;
+	}
+	w->next = NULL;
+	w->callback = callback;
+	w->arg = arg;
+	*tail = w;
+	return er;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Hand the response of a request to its callback and to every
+ * request that joined it
+ * @param er	Request answered, freed by the caller
+ * @param buf	Response, NULL on timeout
+ * @param len	Length of the response
+ *
+ * Each callback gets its own copy of the response to work on.
+ */
+static void
+eemr_complete(struct eemr *er, char *buf, size_t len)
+{
+    char reply[EEM_MTU + 1];
+    char copy[EEM_MTU + 1];
+    struct eemr_waiter *w;
+    /* A request a callback makes must not join this one, it is done */
+    er->key = 0;
+    if (buf && er->waiters) {
+	len = len < EEM_MTU ? len : EEM_MTU;
+	memcpy(reply, buf, len);
+	reply[len] = '\0';
+    }
+    if (er->user_callback) {
+	er->user_callback(buf, len, er->user_data);
+    }
+    while ((w = er->waiters)) {
+	er->waiters = w->next;
+	if (buf) {
+	    memcpy(copy, reply, len + 1);
+	}
+	w->callback(buf ? copy : NULL, len, w->arg);
+	free(w);
+    }
+}
+
+/**
+ * @brief Add a request behind every queued request of its class or higher
+ * @param e	EEM session
+ * @param er	Request to queue
+ *
+ * The head of the queue may be in flight and is never passed, so a
+ * transaction is not interrupted; requests of the same class stay FIFO.
+ */
+static void
+eemr_enqueue(struct eem *e, struct eemr *er)
+{
+    struct eemr *pos;
+    list_for_each_entry (pos, &e->queue, list) {
+	if (&pos->list != e->queue.next && pos->prio > er->prio) {
+	    list_add_tail(&er->list, &pos->list);
+	    return;
+	}
+    }
+    list_add_tail(&er->list, &e->queue);
+}
+
+/**
+ * @brief Move the request to send next to the head of the queue
+ * @param e	EEM session
+ *
+ * Called at a transaction boundary. The most urgent class goes first,
+ * unless some request is past its deadline: then the most urgent overdue
+ * one goes first, so a busy alarm or telemetry cycle cannot starve the
+ * classes below it. A head that was already selected keeps its place
+ * until it is answered or given up.
+ */
+static void
+eemr_schedule(struct eem *e)
+{
+    struct pwr *pwr = e->pwr;
+    struct eemr *er;
+    struct eemr *best = NULL;
+    struct eemr *overdue = NULL;
+    time_t now = time_monotonic();
+    if ((er = eemr_first(e)) && er->send_count) {
+	return;
+    }
+    list_for_each_entry (er, &e->queue, list) {
+	if (!best || er->prio < best->prio) {
+	    best = er;
+	}
+	if (er->deadline <= now && (!overdue || er->prio < overdue->prio)) {
+	    overdue = er;
+	}
+    }
+    if (overdue) {
+	best = overdue;
+    }
+    if (best && &best->list != e->queue.next) {
+	eem_printf("%.8s moved ahead\n", best->request_len ? best->request : "-");
+	list_move(&best->list, &e->queue);
+    }
+}
+
+static uint32_t eem_rto_min_ms = EEM_RTO_MIN_MS;
+static uint32_t eem_rto_max_ms = EEM_RTO_MAX_MS;
+
+/**
+ * @brief Set the floor and ceiling of the retransmit timeout
+ * @param min_ms	Shortest retransmit timeout in ms
+ * @param max_ms	Longest retransmit timeout in ms
+ */
+void
+eem_set_rto_limits(uint32_t min_ms, uint32_t max_ms)
+{
+    if (min_ms && min_ms <= max_ms) {
+	eem_rto_min_ms = min_ms;
+	eem_rto_max_ms = max_ms;
+    }
+}
+
+/**
+ * @brief Round trip estimate of a command
+ * @param pwr	Power system
+ * @param cmd	Command
+ * @return	The estimate, NULL when the power system has no EEM session
+ */
+const struct eem_rtt *
+eem_rtt_stats(struct pwr *pwr, eem_cmd_t cmd)
+{
+    struct eem *e = pwr->internal;
+    if (!e || cmd >= EEM_CMD_TYPES) {
+	return NULL;
+    }
+    return &e->rtt[cmd];
+}
+
+/* Print the round trip estimates of the commands the session has timed */
+static void
+eem_rtt_print(struct eem *e)
+{
+    struct pwr *pwr = e->pwr;
+    const struct eem_rtt *rtt;
+    eem_cmd_t cmd;
+    for (cmd = 0; cmd < EEM_CMD_TYPES; cmd++) {
+	rtt = &e->rtt[cmd];
+	if (rtt->samples || rtt->timeouts) {
+	    eem_printf("%.2s srtt %u rttvar %u rto %u ms, %u samples, "
+		       "%u timeouts\n", eem_cmd_name[cmd], rtt->srtt,
+		       rtt->rttvar, rtt->rto, rtt->samples, rtt->timeouts);
+	}
+    }
+}
+
+static uint64_t
+eem_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static uint32_t
+eem_rto_clamp(uint32_t rto)
+{
+    if (rto < eem_rto_min_ms) {
+	return eem_rto_min_ms;
+    }
+    return rto > eem_rto_max_ms ? eem_rto_max_ms : rto;
+}
+
+static uint32_t
+eem_rto(const struct eem_rtt *rtt)
+{
+    return eem_rto_clamp(rtt->rto ? rtt->rto : EEM_RTO_INIT_MS);
+}
+
+/**
+ * @brief Feed a round trip time into the estimate of a command
+ * @param rtt	Estimate to update
+ * @param r	Measured round trip time in ms
+ */
+static void
+eem_rtt_sample(struct eem_rtt *rtt, uint32_t r)
+{
+    uint32_t delta;
+    if (!rtt->samples++) {
+	rtt->srtt = r;
+	rtt->rttvar = r / 2;
+    } else {
+	delta = r > rtt->srtt ? r - rtt->srtt : rtt->srtt - r;
+	rtt->rttvar = (3 * rtt->rttvar + delta) / 4;
+	rtt->srtt = (7 * rtt->srtt + r) / 8;
+    }
+    rtt->rto = eem_rto_clamp(rtt->srtt
+			     + (4 * rtt->rttvar > EEM_RTO_GRANULARITY_MS
+				? 4 * rtt->rttvar : EEM_RTO_GRANULARITY_MS));
+}
+
+static void
+eem_evtimer_ms_add(struct event *ev, uint32_t ms)
+{
+    struct timeval tv = {ms / 1000, (ms % 1000) * 1000};
+    evtimer_add(ev, &tv);
+}
+
+/* Arm the request timeout from the estimate of the request's command */
+static void
+eem_arm_timeout(struct eem *e, const struct eemr *er)
+{
+    eem_evtimer_ms_add(e->timeout_event, eem_rto(&e->rtt[er->cmd]));
+}
+
+/* Connect attempts of all sessions draw from one token bucket */
+static struct {
+    uint64_t stamp_ms;
+    uint32_t millitokens;
+} eem_connect_bucket = {0, EEM_CONNECT_BURST * 1000};
+
+/**
+ * @brief Take a connect token
+ * @param wait_ms	Set to the time until the next token when none is left
+ * @return		true when the caller may connect now
+ */
+static bool
+eem_connect_token(uint32_t *wait_ms)
+{
+    uint64_t now = eem_now_ms();
+    uint64_t refill = (now - eem_connect_bucket.stamp_ms) * EEM_CONNECT_RATE;
+    eem_connect_bucket.stamp_ms = now;
+    if (refill > EEM_CONNECT_BURST * 1000 - eem_connect_bucket.millitokens) {
+	eem_connect_bucket.millitokens = EEM_CONNECT_BURST * 1000;
+    } else {
+	eem_connect_bucket.millitokens += refill;
+    }
+    if (eem_connect_bucket.millitokens >= 1000) {
+	eem_connect_bucket.millitokens -= 1000;
+	return true;
+    }
+    *wait_ms = (1000 - eem_connect_bucket.millitokens) / EEM_CONNECT_RATE + 1;
+    return false;
+}
+
+/**
+ * @brief Arm the reconnect timer, exponential backoff with full jitter
+ * @param e	EEM session
+ *
+ * The delay is drawn uniformly from zero up to the backoff of the attempt,
+ * so sessions that failed together spread out instead of reconnecting in
+ * lockstep.
+ */
+static void
+eem_reconnect_later(struct eem *e)
+{
+    uint32_t cap = EEM_BACKOFF_BASE_MS;
+    uint8_t i;
+    for (i = 0; i < e->reconnect_attempts && cap < EEM_BACKOFF_MAX_MS; i++) {
+	cap *= 2;
+    }
+    if (cap > EEM_BACKOFF_MAX_MS) {
+	cap = EEM_BACKOFF_MAX_MS;
+    }
+    if (e->reconnect_attempts < UINT8_MAX) {
+	e->reconnect_attempts++;
+    }
+    evtimer_del(e->event);
+    eem_evtimer_ms_add(e->event, random() % (cap + 1));
+}
+
 static void
 eem_select(struct eem *e)
 {
@@ -498,12 +936,14 @@ eem_select(struct eem *e)
     buf[len++] = bcc;
     bufferevent_write(e->bev, buf, len);
     er->send_count++;
-    evtimer_sec_add(e->timeout_event, EEM_TIMEOUT);
+    e->select_ms = eem_now_ms();
+    eem_arm_timeout(e, er);
 }
 
 static void
 eem_poll(struct eem *e)
 {
+    struct eemr *er;
     char buf[POLL_LEN];
     char *p = buf;
     *p++ = EOT;
@@ -516,7 +956,9 @@ eem_poll(struct eem *e)
     *p++ = POLL;
     *p = ENQ;
     bufferevent_write(e->bev, buf, sizeof buf);
-    evtimer_sec_add(e->timeout_event, EEM_TIMEOUT);
+    if ((er = eemr_first(e))) {
+	eem_arm_timeout(e, er);
+    }
 }
 
 #ifdef EEM_FAKE
@@ -569,20 +1011,19 @@ static void
 eemr_send_next(struct eem *e)
 {
     struct eemr *er;
-    eem_callback_t *callback;
     if (!e->bev) {
 	return;
     }
-    while ((er = eemr_first(e))) {
+    for (eemr_schedule(e); (er = eemr_first(e)); eemr_schedule(e)) {
 	if (er->request_len) {
 #ifdef EEM_FAKE
 	    size_t i;
 	    char buf[EEM_MTU];
-	    if ((callback = er->user_callback)) {
+	    if (er->user_callback) {
 		for (i = 0; i < MAXCOUNT(fake); i++) {
 		    if (!strcmp(er->request, fake[i].request)) {
 			COPY(buf, fake[i].response);
-			callback(buf, strlen(buf), er->user_data);
+			eemr_complete(er, buf, strlen(buf));
 			eemr_free(er);
 			break;
 		    }
@@ -594,9 +1035,7 @@ eemr_send_next(struct eem *e)
 	    return;
 	}
 	/* Dummy request used for queue checkpoint callback */
-	if ((callback = er->user_callback)) {
-	    callback(NULL, 0, er->user_data);
-	}
+	eemr_complete(er, NULL, 0);
 	eemr_free(er);
     }
 }
@@ -608,9 +1047,13 @@ eem_close(struct eem *e)
 	bufferevent_free(e->bev);
 	e->bev = NULL;
     }
+    e->rx.state = EEM_RX_HUNT;
     e->state = EEM_INACTIVE;
+    if (e->sweep_event) {
+	evtimer_del(e->sweep_event);
+    }
     if (e->event) {
-	evtimer_sec_add(e->event, 5);
+	eem_reconnect_later(e);
     }
 }
 
@@ -633,6 +1076,12 @@ eemdev_datafree(struct eemdev *ed)
 	free(ed->data.do_value);
 	ed->data.do_value = NULL;
     }
+    /* Without values to keep, the next reply has to be decoded in full */
+    free(ed->raw);
+    ed->raw = NULL;
+    ed->raw_size = 0;
+    /* and is wanted on the next sweep */
+    ed->next_poll = 0;
 }
 
 static void
@@ -643,6 +1092,7 @@ eem_forget(struct eem *e)
 	eemdev_datafree(ed);
     }
     e->rb_rq_loop = false;
+    e->rc_valid = false;
     pwr_forget(e->pwr);
 }
 
@@ -660,7 +1110,7 @@ eemr_timeout(int fd UNUSED, short what UNUSED, void *arg)
     struct pwr *pwr = arg;
     struct eem *e = pwr->internal;
     struct eemr *er;
-    eem_callback_t *callback;
+    struct eem_rtt *rtt;
     time_t t, td;
     if (!(er = eemr_first(e))) {
 	return;
@@ -669,6 +1119,11 @@ eemr_timeout(int fd UNUSED, short what UNUSED, void *arg)
 	eem_connect(pwr);
 	return;
     }
+    /* Back off until a response that was not retransmitted is timed */
+    rtt = &e->rtt[er->cmd];
+    rtt->rto = eem_rto_clamp(2 * eem_rto(rtt));
+    rtt->timeouts++;
+    eem_printf("%.2s rto %u ms\n", eem_cmd_name[er->cmd], rtt->rto);
     if (er->send_count < MAX_SEND_COUNT) {
 	eem_select(e);
 	return;
@@ -683,9 +1138,7 @@ eemr_timeout(int fd UNUSED, short what UNUSED, void *arg)
 	}
     }
     eem_printf("timeout\n");
-    if ((callback = er->user_callback)) {
-	callback(NULL, 0, er->user_data);
-    }
+    eemr_complete(er, NULL, 0);
     eemr_free(er);
     eemr_send_next(e);
 }
@@ -697,7 +1150,11 @@ eemr_timeout(int fd UNUSED, short what UNUSED, void *arg)
  * @param request_len	Length of request data
  * @param callback	Callback function pointer
  * @param arg		Request user data
- * @return		The EEM request data structure
+ * @return		The EEM request data structure, NULL when out of memory
+ *			or when the queue already holds EEM_QUEUE_MAX requests
+ *
+ * A read identical to one already queued or in flight is not sent again:
+ * its callback joins the existing request and gets the same response.
  */
 static struct eemr *
 eemr_new(struct pwr *pwr, const char *request,
@@ -705,25 +1162,42 @@ eemr_new(struct pwr *pwr, const char *request,
 {
     struct eem *e = pwr->internal;
     size_t request_len;
+    uint64_t key;
     struct eemr *er = NULL;
     int empty;
-    if (e && (er = MALLOCP(struct eemr))) {
+    if (!e) {
+	return NULL;
+    }
+    request_len = request ? strlen(request) : 0;
+    if (request_len > REQUEST_LEN) {
+	request_len = REQUEST_LEN;
+    }
+    if ((key = eemr_key(request, request_len))
+	&& (er = eemr_join(e, key, callback, arg))) {
+	eem_printf("%.8s joined\n", er->request);
+	return er;
+    }
+    if (e->queue_len >= EEM_QUEUE_MAX) {
+	eem_printf("queue full, dropping %.8s\n", request ? request : "");
+	return NULL;
+    }
+    if ((er = malloc(sizeof *er + request_len + 1))) {
 	ZERO(er);
-	if (request) {
-	    request_len = strlen(request);
-	    if (request_len > sizeof(er->request)) {
-		request_len = sizeof(er->request);
-	    }
+	if (request_len) {
 	    memmove(er->request, request, request_len);
-	} else {
-	    request_len = 0;
-	    er->request[0] = '\0';
 	}
+	er->request[request_len] = '\0';
 	er->request_len = request_len;
+	er->eem = e;
 	er->user_callback = callback;
 	er->user_data = arg;
+	er->key = key;
+	er->prio = eemr_prio(request);
+	er->cmd = eemr_cmd(request);
+	er->deadline = time_monotonic() + eem_prio_deadline[er->prio];
 	empty = list_empty(&e->queue);
-	list_add_tail(&er->list, &e->queue);
+	eemr_enqueue(e, er);
+	e->queue_len++;
 	if (empty) {
 	    switch (e->state) {
 	    case EEM_INACTIVE:
@@ -745,96 +1219,80 @@ eem_readcb(struct bufferevent *bev, void *arg)
 {
     struct pwr *pwr = arg;
     struct eem *e = pwr->internal;
-    static size_t count;
-    static char buf[2 * EEM_MTU];
-    eem_callback_t *callback;
+    struct eem_rx *rx;
+    char buf[EEM_MTU];
     struct eemr *er;
     uint8_t bcc;
     size_t len;
-    size_t prelen;
-    size_t plen;
-    char *start;
-    char *end;
+    size_t used;
+    char *p;
     if (!e || !MO_getref(&pwr->ins)) {
 	return;
     }
-    while ((len = bufferevent_read(bev, buf + count, sizeof buf - count))) {
+    rx = &e->rx;
+    while ((len = bufferevent_read(bev, buf, sizeof buf))) {
 	if (len == (size_t)-1) {
 	    break;
 	}
-	count += len;
-	while (count) {
-	    buf[count] = '\0';
-	    prelen = strcspn(buf, eem_delimit);
-	    if (prelen < count) {
-		if (prelen) {
-		    dump("EEM?>", buf, prelen);
+	p = buf;
+	while (len) {
+	    eem_rx_event_t event = eem_rx_feed(rx, p, len, &used);
+	    p += used;
+	    len -= used;
+	    switch (event) {
+	    case EEM_RX_MORE:
+		break;
+	    case EEM_RX_FRAME:
+		if ((bcc = eem_bcc(rx->sum)) != rx->bcc) {
+		    eem_printf("Incorrect checksum %02X != %02X\n",
+			       rx->bcc, bcc);
 		}
-		start = buf + prelen;
-		switch (start[0]) {
-		case SOH:
-		    len = count - prelen;
-		    if (!(end = memchr(start, ETX, len))) {
-			goto more;
-		    }
-		    plen = end - start + 1;
-		    if (plen > len) {
-			goto more;
-		    }
-		    bcc = eem_checksum(start + 1, plen - 1);
-		    if (bcc != start[plen]) {
-			eem_printf("Incorrect checksum %02X != %02X\n",
-				   start[plen], bcc);
-		    }
-		    bufferevent_write(e->bev, eem_ack, sizeof eem_ack);
-		    plen++;
-		    if ((er = eemr_first(e))) {
-			if ((callback = er->user_callback)) {
-			    callback(start + 8, plen - 10, er->user_data);
-			}
-			eemr_free(er);
+		bufferevent_write(e->bev, eem_ack, sizeof eem_ack);
+		if ((er = eemr_first(e))) {
+		    /* Karn: a retransmitted request gives an ambiguous sample */
+		    if (er->send_count == 1) {
+			eem_rtt_sample(&e->rtt[er->cmd],
+				       eem_now_ms() - e->select_ms);
 		    }
-		    count = len - plen;
-		    if (count) {
-			memmove(buf, end + 1, count);
-		    }
-		    e->tmout_cnt = 0;
-		    break;
-		case ACK:
-		    if (e && !list_empty(&e->queue) && e->bev) {
-			eem_poll(e);
-		    }
-		    goto skip;
-		case NAK:
-		    eem_printf("NAK\n");
-		    goto skip;
-		case EOT:
-		    eemr_send_next(e);
-		skip:
-		    if (--count) {
-			memmove(start, start + 1, count);
-		    }
-		    if(++e->tmout_cnt >= 5) {
-		        eem_printf("timeout [%d]\n", start[0], e->tmout_cnt);
-		        if(!(e->tmout_cnt % 5)) {
-		            eem_lost(e);
-		            eem_printf("t disconnect\n", start[0], e->tmout_cnt);
-		            if(evtimer_pending(e->event, NULL)) {
-		                evtimer_del(e->event);
-		                evtimer_sec_add(e->event, 15);
-		            }
-		            return;
-		        }
+		    eemr_complete(er, rx->buf + 7, rx->len - 8);
+		    eemr_free(er);
+		}
+		e->tmout_cnt = 0;
+		break;
+	    case EEM_RX_ACK:
+		if (e && !list_empty(&e->queue) && e->bev) {
+		    eem_poll(e);
+		}
+		goto skip;
+	    case EEM_RX_NAK:
+		eem_printf("NAK\n");
+		goto skip;
+	    case EEM_RX_EOT:
+		eemr_send_next(e);
+	    skip:
+		if(++e->tmout_cnt >= 5) {
+		    eem_printf("timeout [%d]\n", e->tmout_cnt);
+		    if(!(e->tmout_cnt % 5)) {
+			/* eem_close() arms the reconnect backoff */
+			eem_lost(e);
+			eem_printf("t disconnect\n");
+			return;
 		    }
-		    break;
 		}
-	    } else {
-		dump("EEM?>", buf, count);
-		count = 0;
 		break;
 	    }
 	}
-    more:;
+    }
+}
+
+/* Free the flushed writes of a block once their requests are gone */
+static void
+eemdev_wb_free(struct eemdev *ed)
+{
+    struct eem_wb *wb;
+    while ((wb = ed->wb_sent)) {
+	ed->wb_sent = wb->next;
+	free(wb);
     }
 }
 
@@ -845,10 +1303,15 @@ eemr_free_all(struct eem *e)
     struct list_head *pos;
     struct list_head *next;
     struct eemr *er;
+    struct eemdev *ed;
     list_for_each_safe (pos, next, head) {
 	er = list_entry(pos, struct eemr, list);
 	eemr_free(er);
     }
+    /* The WB and RB requests owned them */
+    list_for_each_entry (ed, &e->device, list) {
+	eemdev_wb_free(ed);
+    }
 }
 
 static void
@@ -862,6 +1325,9 @@ eemdev_free(struct eemdev *ed)
     }
 #endif
     eemdev_datafree(ed);
+    free(ed->wb);
+    eemdev_wb_free(ed);
+    eem_index_del(&ed->eem->device_index, eem_id_key(ed->id));
     list_del(&ed->list);
     free(ed);
 }
@@ -888,6 +1354,12 @@ eem_free(struct eem *e)
     if (e->snmp_event) {
         event_free(e->snmp_event);
     }
+    if (e->wb_event) {
+	event_free(e->wb_event);
+    }
+    if (e->sweep_event) {
+	event_free(e->sweep_event);
+    }
     list_for_each_entry_safe (ed, next_ed, &e->device, list) {
 	eemdev_free(ed);
     }
@@ -898,6 +1370,9 @@ eem_free(struct eem *e)
 	free(ep);
     }
 #endif
+    eem_index_free(&e->device_index);
+    eem_index_free(&e->physical_index);
+    free(e->rc_pages);
     eemr_free_all(e);
     free(e);
 }
@@ -946,13 +1421,7 @@ eemdev_cmp(struct eemdev *ed, const char *id)
 struct eemdev *
 eemdev_find(struct eem *e, const char *id)
 {
-    struct eemdev *ed;
-    list_for_each_entry (ed, &e->device, list) {
-	if (!eemdev_cmp(ed, id)) {
-	    return ed;
-	}
-    }
-    return NULL;
+    return eem_index_find(&e->device_index, eem_id_key(id));
 }
 
 static struct eemdev *
@@ -970,6 +1439,11 @@ eemdev_new(struct eem *e, char *id, bool addFirst)
 	ed->eem = e;
 	COPY(ed->id, id);
 	ed->eemid = eem_getid(id);
+	ed->poll_ms = EEM_POLL_CLASS;
+	if (!eem_index_put(&e->device_index, eem_id_key(ed->id), ed)) {
+	    free(ed);
+	    return NULL;
+	}
 	if (addFirst) {
 	    list_add(&ed->list, &e->device);
 	} else {
@@ -988,6 +1462,10 @@ eemphy_new(struct eem *e, char *id)
     ZERO(ep);
     ep->eem = e;
     COPY(ep->id, id);
+    if (!eem_index_put(&e->physical_index, eem_id_key(ep->id), ep)) {
+        free(ep);
+        return NULL;
+    }
     list_add_tail(&ep->list, &e->physical);
     }
     return ep;
@@ -1002,13 +1480,7 @@ eemphy_cmp(struct eemphy *ep, char *id)
 static struct eemphy *
 eemphy_find(struct eem *e, char *id)
 {
-    struct eemphy *ep;
-    list_for_each_entry (ep, &e->physical, list) {
-    if (!eemphy_cmp(ep, id)) {
-        return ep;
-    }
-    }
-    return NULL;
+    return eem_index_find(&e->physical_index, eem_id_key(id));
 }
 
 static struct eemphr *
@@ -1024,9 +1496,13 @@ eemphr_new(void)
 static struct eemphr *
 eemphr_find(struct eemdev *ed, char *id)
 {
+    struct eemphy *ep;
     struct eemphr *eh;
+    if (!(ep = eemphy_find(ed->eem, id))) {
+    return NULL;
+    }
     list_for_each_entry (eh, &ed->phy, list) {
-    if (!eemphy_cmp(eh->eemphy, id)) {
+    if (eh->eemphy == ep) {
         return eh;
     }
     }
@@ -1217,16 +1693,19 @@ eem_get_done(char *buf UNUSED, size_t len UNUSED, void *arg)
     COPY(eq.identifier, ip_ssaddr_get(&e->dest));
     // Make sure we have a Rectifiers before any Rectifier is created
     list_for_each_entry (ed, &e->device, list) {
-        if ((device = eem_device_find(ed->id))) {
-            if (device->class_index == Rectifiers_index) {
-		break;
-	    } else if (device->class_index == Rectifier_index) {
-		eemdev_new(e, "0200", true);
-		break;
-	    }
+        if (!ed->stale && (device = eem_device_find(ed->id))
+            && device->class_index == Rectifier_index) {
+            /* Not in the RI reply of every controller, never stale */
+            if ((ed = eemdev_new(e, "0200", true))) {
+                ed->stale = false;
+            }
+            break;
         }
     }
     list_for_each_entry (ed, &e->device, list) {
+	if (ed->stale) {
+	    continue;
+	}
 	if ((device = eem_device_find(ed->id))) {
 	    class_index = device->class_index;
 	}
@@ -1323,9 +1802,48 @@ eem_get_done(char *buf UNUSED, size_t len UNUSED, void *arg)
     if (config_modified()) {
 	config_delayed_write(100);
     }
+    eem_inventory_save(pwr);
     eemdev_read_first(e);
 }
 
+/**
+ * @brief Update what a device the RI scan no longer lists left behind
+ * @param pwr	Power system
+ * @param ed	Device gone
+ *
+ * Its MO instances stay, so the operator sees what went, but its last
+ * values are dropped: the rectifier group counts it as lost and a solar
+ * converter raises its LOST alarm, as eem_solar_lost() would.
+ */
+static void
+eemdev_gone(struct pwr *pwr, struct eemdev *ed)
+{
+    struct eem *e = pwr->internal;
+    struct pwr_in *in;
+    MO_instance *ins;
+    eem_printf("%.4s is gone, not read any more\n", ed->id);
+    ed->cached = false;
+    ed->stale = true;
+    eemdev_datafree(ed);
+    if ((ed->eemid == EEM_RECTIFIER || ed->eemid == EEM_SOLAR_CONVERTER)
+	&& (in = ed->pwrp)) {
+	in->active = false;
+	if (ed->eemid == EEM_SOLAR_CONVERTER && (ins = MO_getref(&in->ins))) {
+	    MO_alarm(LICENSE_SOLAR, ins, LOST, true);
+	}
+    }
+}
+
+/**
+ * @brief Take in an RI reply, the IDs of the devices the controller has
+ *
+ * The IDs are diffed against the devices known already. Only a device
+ * new to the session, or listed again after it went, gets its RP and DL
+ * requests, and only a new rectifier or controller restarts the NCU SNMP
+ * inventory; eem_get_done() then adds their MO instances. A device no
+ * longer listed is handed to eemdev_gone(). A scan that adds nothing
+ * leaves the MO tree alone. The first scan after a connect adds all.
+ */
 static void
 eem_ri(char *buf, size_t len, void *arg)
 {
@@ -1336,36 +1854,61 @@ eem_ri(char *buf, size_t len, void *arg)
     size_t n;
     char *p;
     const struct eem_device *device;
+    bool listed = false;
+    bool all = !e->ri_hash;
+    bool added = false;
+    bool removed = false;
+    bool snmp = false;
+    bool fresh;
+    uint64_t hash;
     if (!buf) {
 	goto out;
     }
     eem_dump(e, buf, len);
     buf[len] = '\0';
+    if ((hash = eem_fnv(EEM_FNV_INIT, buf, len)) == e->ri_hash) {
+	/* Same devices as the last scan, only a missing name is retried */
+	list_for_each_entry (ed, &e->device, list) {
+	    if (!ed->name[0] && !ed->stale && ed->ri_gen) {
+		snprintf(command, sizeof command, "RP%.4s", ed->id);
+		eemr_new(pwr, command, eem_rp, ed);
+	    }
+	}
+	goto out;
+    }
+    e->ri_gen++;
     p = buf;
     while (len && (n = eem_fieldlen(p))) {
 	if (n >= sizeof ed->id - 1) {
-	    if ((device = eem_device_find(p))
-		&& (device->class_index == Rectifiers_index)) {
+	    ed = eemdev_find(e, p);
+	    fresh = all || !ed || ed->stale || !ed->ri_gen;
+	    if (!ed) {
 		// Makes sure Rectifiers is before any Rectifier in the list.
-		if (!(ed = eemdev_new(e, p, true))) {
-		    break;
-		}
-	    } else {
-		if (!(ed = eemdev_new(e, p, false))) {
+		ed = eemdev_new(e, p, (device = eem_device_find(p))
+				&& device->class_index == Rectifiers_index);
+		if (!ed) {
 		    break;
 		}
 	    }
-        snprintf(command, sizeof command, "RP%.4s", p);
+	    ed->cached = false;
+	    ed->stale = false;
+	    ed->ri_gen = e->ri_gen;
+	    listed = true;
+	    snprintf(command, sizeof command, "RP%.4s", p);
 	    if (!ed->name[0]) {
 		eemr_new(pwr, command, eem_rp, ed);
 	    }
+	    if (fresh) {
+		added = true;
+		snmp = snmp || ed->eemid == EEM_RECTIFIER;
 #ifdef EEMPHY
-	    if (memcmp(p, CSU_ID, sizeof ed->id - 1)) {
-		command[0] = 'D';
-		command[1] = 'L';
-		eemr_new(pwr, command, eem_dl, ed);
-	    }
+		if (memcmp(p, CSU_ID, sizeof ed->id - 1)) {
+		    command[0] = 'D';
+		    command[1] = 'L';
+		    eemr_new(pwr, command, eem_dl, ed);
+		}
 #endif
+	    }
 	}
 	len -= n;
 	p += n;
@@ -1373,13 +1916,34 @@ eem_ri(char *buf, size_t len, void *arg)
 	p += n;
 	len -= n;
     }
-    if ((ed = eemdev_new(e, CSU_ID, false))) {
+    if ((ed = eemdev_find(e, CSU_ID))
+	&& !all && !ed->stale && ed->ri_gen) {
+	ed->ri_gen = e->ri_gen;
+    } else if ((ed = eemdev_new(e, CSU_ID, false))) {
 	COPY(ed->name, e->name);
+	ed->cached = false;
+	ed->stale = false;
+	ed->ri_gen = e->ri_gen;
+	added = snmp = true;
+    }
+    if (listed) {
+	/* What an earlier scan or the cache had and this one has not */
+	list_for_each_entry (ed, &e->device, list) {
+	    if ((ed->cached || ed->ri_gen) && ed->ri_gen != e->ri_gen
+		&& !ed->stale) {
+		eemdev_gone(pwr, ed);
+		removed = true;
+	    }
+	}
+	e->ri_hash = hash;
+    }
+    if (added && snmp && pwr_type_ncu(pwr)) {
+	evtimer_sec_add(e->snmp_event, 1);
+    } else if (added) {
+	eemr_new(pwr, NULL, eem_get_done, pwr);
+    } else if (removed) {
+	eem_inventory_save(pwr);
     }
-    if (pwr_type_ncu(pwr)) {
-        evtimer_sec_add(e->snmp_event, 1);
-    } else
-        eemr_new(pwr, NULL, eem_get_done, pwr);
 out:
     if (e->scan_event) {
 	evtimer_sec_add(e->scan_event, EEM_SCAN_PERIOD);
@@ -1406,6 +1970,304 @@ eem_rn(char *buf, size_t len, void *arg)
     }
 }
 
+/*
+ * The inventory of a controller (its name, devices, physical units and
+ * the serials read over SNMP) is kept on disk, one file per controller
+ * endpoint. After a restart a session builds its devices from the file
+ * and starts reading blocks straight away; the RN/RI/RP, DL/DP and SNMP
+ * inventory still runs, behind the telemetry, and corrects the devices
+ * and the file.
+ *
+ * One record per line, a tag then fields separated by tabs:
+ *	N <controller name>
+ *	S <product model> <software revision> <serial number>
+ *	D <device id> <name>
+ *	P <unit id> <group> <subgroup> <product> <serial> <HW rev> <SW rev>
+ *	L <device id> <unit id>
+ *	R <rectifier id> <product> <software revision> <serial number>
+ */
+#define EEM_INVENTORY_MAGIC "EEMINV 1\n"
+#define EEM_INVENTORY_FIELDS 8
+
+struct eem_inventory_writer {
+    FILE *f;			/* NULL to only hash */
+    uint64_t hash;
+};
+
+/**
+ * @brief Name the inventory cache of a session after host, port and
+ * controller ID, as several controllers may share a terminal server
+ */
+static void
+eem_inventory_path(const struct eem *e, char *path, size_t size)
+{
+    const char *addr = ip_ssaddr_get(&e->dest);
+    const struct sockaddr *sa = SOCKADDR(&e->dest);
+    size_t n = strlen(EEM_INVENTORY_DIR) + 1;
+    unsigned port;
+    char *p;
+    if (sa->sa_family == AF_INET6) {
+	port = ntohs(((const struct sockaddr_in6 *)sa)->sin6_port);
+    } else {
+	port = ntohs(((const struct sockaddr_in *)sa)->sin_port);
+    }
+    snprintf(path, size, "%s/%s-%u-%.2s.inv", EEM_INVENTORY_DIR,
+	     addr ? addr : "", port, e->cc_id);
+    for (p = path + (n < size ? n : size - 1); *p; p++) {
+	if (!isalnum((unsigned char)*p) && *p != '.' && *p != '-') {
+	    *p = '_';
+	}
+    }
+}
+
+/**
+ * @brief Write one record, tabs and line breaks in fields made spaces
+ */
+static void
+eem_inventory_put(struct eem_inventory_writer *w, char tag,
+		  const char *const *field, size_t count)
+{
+    char line[512];
+    size_t n = 0;
+    size_t i;
+    const char *p;
+    line[n++] = tag;
+    for (i = 0; i < count; i++) {
+	line[n++] = i ? '\t' : ' ';
+	for (p = field[i]; *p && n < sizeof line - 2; p++) {
+	    line[n++] = *p == '\t' || *p == '\n' || *p == '\r' ? ' ' : *p;
+	}
+    }
+    line[n++] = '\n';
+    w->hash = eem_fnv(w->hash, line, n);
+    if (w->f) {
+	fwrite(line, 1, n, w->f);
+    }
+}
+
+#define eem_inventory_record(w, tag, ...) \
+    eem_inventory_put(w, tag, (const char *const []) {__VA_ARGS__}, \
+		      sizeof (const char *const []) {__VA_ARGS__} / sizeof (char *))
+
+static void
+eem_inventory_render(struct pwr *pwr, struct eem_inventory_writer *w)
+{
+    struct eem *e = pwr->internal;
+    struct eemdev *ed;
+    struct pwr_in *in;
+#ifdef EEMPHY
+    struct eemphy *ep;
+    struct eemphr *eh;
+#endif
+    w->hash = eem_fnv(EEM_FNV_INIT, EEM_INVENTORY_MAGIC,
+				 strlen(EEM_INVENTORY_MAGIC));
+    if (w->f) {
+	fputs(EEM_INVENTORY_MAGIC, w->f);
+    }
+    eem_inventory_record(w, 'N', e->name);
+    eem_inventory_record(w, 'S', e->ProductModel, e->SWrevision,
+			 e->SerialNum);
+    list_for_each_entry (ed, &e->device, list) {
+	if (!ed->stale) {
+	    eem_inventory_record(w, 'D', ed->id, ed->name);
+	}
+    }
+#ifdef EEMPHY
+    list_for_each_entry (ep, &e->physical, list) {
+	eem_inventory_record(w, 'P', ep->id, ep->group, ep->subgroup,
+			     ep->product_number, ep->serial_number,
+			     ep->HW_revision, ep->SW_revision);
+    }
+    list_for_each_entry (ed, &e->device, list) {
+	list_for_each_entry (eh, &ed->phy, list) {
+	    if (!ed->stale) {
+		eem_inventory_record(w, 'L', ed->id, eh->eemphy->id);
+	    }
+	}
+    }
+#endif
+    list_for_each_entry (ed, &e->device, list) {
+	if (ed->eemid == EEM_RECTIFIER && !ed->stale && (in = ed->pwrp)
+	    && (in->productNum[0] || in->SerialNum[0])) {
+	    eem_inventory_record(w, 'R', ed->id, in->productNum,
+				 in->swProdRevision, in->SerialNum);
+	}
+    }
+}
+
+#undef eem_inventory_record
+
+/**
+ * @brief Write the inventory cache of the session, unless it is unchanged
+ */
+static void
+eem_inventory_save(struct pwr *pwr)
+{
+    struct eem *e = pwr->internal;
+    struct eem_inventory_writer w = {NULL, 0};
+    char path[256];
+    char tmp[sizeof path + 4];
+    if (list_empty(&e->device) || e->inventory_loading) {
+	return;
+    }
+    eem_inventory_render(pwr, &w);
+    if (w.hash == e->inventory_hash) {
+	return;
+    }
+    eem_inventory_path(e, path, sizeof path);
+    snprintf(tmp, sizeof tmp, "%s.new", path);
+    if (mkdir(EEM_INVENTORY_DIR, 0755) && errno != EEXIST) {
+	return;
+    }
+    if (!(w.f = fopen(tmp, "w"))) {
+	eem_printf("%s: %s\n", tmp, strerror(errno));
+	return;
+    }
+    eem_inventory_render(pwr, &w);
+    if (fclose(w.f) || rename(tmp, path)) {
+	eem_printf("%s: %s\n", path, strerror(errno));
+	unlink(tmp);
+	return;
+    }
+    e->inventory_hash = w.hash;
+}
+
+/**
+ * @brief Take in the records of the inventory cache whose tags are in tags
+ * @param buf	Cache contents past the magic line, NUL terminated; not
+ *		changed
+ */
+static void
+eem_inventory_apply(struct pwr *pwr, const char *buf, const char *tags)
+{
+    struct eem *e = pwr->internal;
+    struct eemdev *ed;
+    struct pwr_in *in;
+#ifdef EEMPHY
+    struct eemphy *ep;
+    struct eemphr *eh;
+#endif
+    char line[512];
+    char *f[EEM_INVENTORY_FIELDS];
+    size_t count;
+    size_t n;
+    char *p;
+    for (; *buf; buf += n + (buf[n] == '\n')) {
+	n = strcspn(buf, "\n");
+	if (n < 2 || n >= sizeof line || buf[1] != ' '
+	    || !strchr(tags, buf[0])) {
+	    continue;
+	}
+	memcpy(line, buf + 2, n - 2);
+	line[n - 2] = '\0';
+	for (count = 0, p = line; count < MAXCOUNT(f); count++) {
+	    f[count] = p;
+	    if (!(p = strchr(p, '\t'))) {
+		count++;
+		break;
+	    }
+	    *p++ = '\0';
+	}
+	switch (buf[0]) {
+	case 'N':
+	    COPY(e->name, f[0]);
+	    break;
+	case 'S':
+	    if (count >= 3) {
+		COPY(e->ProductModel, f[0]);
+		COPY(e->SWrevision, f[1]);
+		COPY(e->SerialNum, f[2]);
+	    }
+	    break;
+	case 'D':
+	    if (count >= 2 && strlen(f[0]) == IDLEN - 1
+		&& (ed = eemdev_new(e, f[0], false))) {
+		COPY(ed->name, f[1]);
+		ed->cached = true;
+	    }
+	    break;
+#ifdef EEMPHY
+	case 'P':
+	    if (count >= 7 && strlen(f[0]) == IDLEN - 1
+		&& ((ep = eemphy_find(e, f[0])) || (ep = eemphy_new(e, f[0])))) {
+		COPY(ep->group, f[1]);
+		COPY(ep->subgroup, f[2]);
+		COPY(ep->product_number, f[3]);
+		COPY(ep->serial_number, f[4]);
+		COPY(ep->HW_revision, f[5]);
+		COPY(ep->SW_revision, f[6]);
+	    }
+	    break;
+	case 'L':
+	    if (count >= 2 && (ed = eemdev_find(e, f[0]))
+		&& (ep = eemphy_find(e, f[1])) && !eemphr_find(ed, f[1])
+		&& (eh = eemphr_new())) {
+		eh->eemphy = ep;
+		list_add_tail(&eh->list, &ed->phy);
+	    }
+	    break;
+#endif
+	case 'R':
+	    if (count >= 4 && (in = pwr_in_find(pwr, f[0]))) {
+		COPY(in->productNum, f[1]);
+		COPY(in->swProdRevision, f[2]);
+		COPY(in->SerialNum, f[3]);
+	    }
+	    break;
+	}
+    }
+}
+
+/**
+ * @brief Build the devices of a new session from its inventory cache and
+ * start reading them
+ * @return	false when there is no usable cache
+ */
+static bool
+eem_inventory_load(struct pwr *pwr)
+{
+    struct eem *e = pwr->internal;
+    struct eem_inventory_writer w = {NULL, 0};
+    char path[256];
+    char *buf;
+    size_t len;
+    FILE *f;
+    bool ok = false;
+    eem_inventory_path(e, path, sizeof path);
+    if (!(f = fopen(path, "r"))) {
+	return false;
+    }
+    if ((buf = malloc(EEM_INVENTORY_MAX + 1))) {
+	len = fread(buf, 1, EEM_INVENTORY_MAX + 1, f);
+	buf[len < EEM_INVENTORY_MAX ? len : EEM_INVENTORY_MAX] = '\0';
+	ok = len <= EEM_INVENTORY_MAX
+	    && !strncmp(buf, EEM_INVENTORY_MAGIC, strlen(EEM_INVENTORY_MAGIC));
+    }
+    fclose(f);
+    if (!ok) {
+	eem_printf("%s: not an inventory cache, ignored\n", path);
+	free(buf);
+	return false;
+    }
+    eem_inventory_apply(pwr, buf + strlen(EEM_INVENTORY_MAGIC), "NSDPL");
+    if (list_empty(&e->device)) {
+	free(buf);
+	return false;
+    }
+    eem_printf("%s: inventory from cache\n", path);
+    /* The file holds this already; the R records are not in yet */
+    e->inventory_loading = true;
+    eem_get_done(NULL, 0, pwr);
+    e->inventory_loading = false;
+    /* The rectifiers exist now */
+    eem_inventory_apply(pwr, buf + strlen(EEM_INVENTORY_MAGIC), "R");
+    free(buf);
+    /* What a save would write now, so an unchanged inventory is not */
+    eem_inventory_render(pwr, &w);
+    e->inventory_hash = w.hash;
+    return true;
+}
+
 static void
 eem_error(struct bufferevent *bev UNUSED, short event, void *arg)
 {
@@ -1414,9 +2276,16 @@ eem_error(struct bufferevent *bev UNUSED, short event, void *arg)
     if (event & BEV_EVENT_CONNECTED) {
 	eem_printf("Connected\n");
 	evtimer_del(e->event);
+	e->reconnect_attempts = 0;
 	e->state = EEM_CONNECTED;
 	eemr_free_all(e);
 	e->rb_rq_loop = false;
+	/* Rediscover everything after a reconnect */
+	e->ri_hash = 0;
+	/* A warm start reads blocks first, the RI below checks the cache */
+	if (list_empty(&e->device)) {
+	    eem_inventory_load(pwr);
+	}
 	if (!e->name[0]) {
 	    eemr_new(pwr, "RN", eem_rn, pwr);
 	}
@@ -1469,7 +2338,12 @@ eem_connect_timeout(int fd UNUSED, short what UNUSED, void *arg)
 {
     struct pwr *pwr = arg;
     struct eem *e = pwr->internal;
+    uint32_t wait_ms;
     if (e->state == EEM_INACTIVE) {
+	if (!eem_connect_token(&wait_ms)) {
+	    eem_evtimer_ms_add(e->event, wait_ms + random() % (wait_ms + 1));
+	    return;
+	}
         e->rb_rq_loop = false;
         eem_connect(pwr);
     }
@@ -1502,7 +2376,7 @@ eem_getstr(const char *s, char *buf, size_t buflen)
 }
 
 static void
-eemdev_read_system(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_system(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
 	float *ai, *ao, tmax = NAN;
 	float temp[NCU_NUM_BATT_TEMP_SENS] = {NAN, NAN, NAN};
@@ -1511,19 +2385,19 @@ eemdev_read_system(struct pwr *pwr, struct eemdev *ed)
 
 	if ((ai = ed->data.ai_value)) {
 		pwr->enabled = true;
-		pwr->voltage = ai[0];
-		pwr->current = ai[1];
-		pwr->power = ai[2] * 1000; /* conversion from kW to W*/
+		pwr->voltage = ai[EEM_SYSTEM_AI_SYSTEM_VOLTAGE];
+		pwr->current = ai[EEM_SYSTEM_AI_SYSTEM_LOAD];
+		pwr->power = ai[EEM_SYSTEM_AI_SYSTEM_POWER] * 1000; /* conversion from kW to W*/
 		if (pwr_type_ncu(pwr)) {
-		    amb_temp = ai[13];   // ambient
+		    amb_temp = ai[EEM_SYSTEM_AI_EIB_1_TEMP_2];   // ambient
 		} else {
-		    amb_temp = ai[6];    // ambient
-		    // outside - ai[7]
+		    amb_temp = ai[EEM_SYSTEM_AI_AMBIENT_TEMPERATURE];    // ambient
+		    // outside - ai[EEM_SYSTEM_AI_OUTSIDE_TEMPERATURE]
 		}
 		eem_temp_sensor(pwr, amb_temp, AMBIENT, 0);
 		if (pwr_type_ncu(pwr)) {
 		    for (i = 0; i < NCU_NUM_BATT_TEMP_SENS; i++) {
-		        temp[i] = ai[10 + i];   // battery
+		        temp[i] = ai[EEM_SYSTEM_AI_IB2_1_TEMP_1 + i];   // battery
 		        eem_temp_sensor(pwr, temp[i], BATT, i);
 		        if (!isnan(temp[i]) && ((isnan(tmax)) || (temp[i] > tmax))) {
 		            tmax = temp[i];
@@ -1534,22 +2408,22 @@ eemdev_read_system(struct pwr *pwr, struct eemdev *ed)
 		}
 	}
 	if (pwr->enabled && (ao = ed->data.ao_value)) {
-	    pwr->device_config.f[bat_float_charge_voltage] = ao[0];
-	    pwr->device_config.f[bat_low_voltage_minor] = ao[1];
-	    pwr->device_config.f[bat_low_voltage_major] = ao[3];
-	    pwr->device_config.f[dc_volt_max] = ao[5];
+	    pwr->device_config.f[bat_float_charge_voltage] = ao[EEM_SYSTEM_AO_SYSTEM_VOLTAGE_SET_POINT];
+	    pwr->device_config.f[bat_low_voltage_minor] = ao[EEM_SYSTEM_AO_UNDER_VOLTAGE_1_LEVEL];
+	    pwr->device_config.f[bat_low_voltage_major] = ao[EEM_SYSTEM_AO_UNDER_VOLTAGE_2_LEVEL];
+	    pwr->device_config.f[dc_volt_max] = ao[EEM_SYSTEM_AO_OVER_VOLTAGE_LEVEL];
 	    if (pwr_type_ncu(pwr)) {
-	        pwr->device_config.f[batt1_high_temp] = ao[14];
-	        pwr->device_config.f[batt1_low_temp] = ao[15];
-	        pwr->device_config.f[batt2_high_temp] = ao[16];
-	        pwr->device_config.f[batt2_low_temp] = ao[17];
-	        pwr->device_config.f[batt3_high_temp] = ao[18];
-	        pwr->device_config.f[batt3_low_temp] = ao[19];
-	        pwr->device_config.f[bat_high_env_temp] = ao[20];
-	        pwr->device_config.f[bat_low_env_temp] = ao[21];
+	        pwr->device_config.f[batt1_high_temp] = ao[EEM_SYSTEM_AO_HIGH_IB2_1_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[batt1_low_temp] = ao[EEM_SYSTEM_AO_LOW_IB2_1_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[batt2_high_temp] = ao[EEM_SYSTEM_AO_HIGH_IB2_2_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[batt2_low_temp] = ao[EEM_SYSTEM_AO_LOW_IB2_2_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[batt3_high_temp] = ao[EEM_SYSTEM_AO_HIGH_EIB_1_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[batt3_low_temp] = ao[EEM_SYSTEM_AO_LOW_EIB_1_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[bat_high_env_temp] = ao[EEM_SYSTEM_AO_HIGH_EIB_2_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[bat_low_env_temp] = ao[EEM_SYSTEM_AO_LOW_EIB_2_TEMPERATURE_LIMIT];
 	    } else {
-	        pwr->device_config.f[bat_high_env_temp] = ao[9];
-	        pwr->device_config.f[bat_low_env_temp] = ao[10];
+	        pwr->device_config.f[bat_high_env_temp] = ao[EEM_SYSTEM_AO_HIGH_AMBIENT_TEMPERATURE_LIMIT];
+	        pwr->device_config.f[bat_low_env_temp] = ao[EEM_SYSTEM_AO_LOW_AMBIENT_TEMPERATURE_LIMIT];
 	    }
 	}
 	eem_create_system_thresholds(pwr);
@@ -1560,13 +2434,13 @@ eem_faulty_rectifiers(struct eem *e)
 {
     int count = 0;
     struct eemdev *ed;
-    uint8_t *di;
+    const eem_bits_t *di;
     if (e) {
 	list_for_each_entry (ed, &e->device, list) {
 	    if (!strncmp(ed->id, "02", 2)
 		    && strncmp(ed->id + 2, "00", 2)
 		    && (di = ed->data.di_value)
-		    && di[2]) {
+		    && eem_bit(di, EEM_RECTIFIER_DI_RECTIFIER_FAILURE)) {
 		count++;
 	    }
 	}
@@ -1593,7 +2467,12 @@ eem_rectifiers_alarms(struct pwr *pwr, struct eemdev *ed, bool mains_alarm)
     bool ov_alarm = false, ht_alarm = false;
     bool limit_alarm = false, fan_alarm = false;
     struct eemdev *dev;
-    uint8_t *di;
+    const eem_bits_t *di;
+    static const eem_bits_t rect_fail = {{
+	(uint64_t)1 << EEM_RECTIFIER_DI_RECTIFIER_FAILURE
+	| (uint64_t)1 << EEM_RECTIFIER_DI_RECTIFIER_FAILURE_2
+    }};
+    eem_bits_t seen = {{0}};
     float *ai = NULL;
     int mo_count = 0;
     bool is_rect_acin_nan = false;
@@ -1606,31 +2485,26 @@ eem_rectifiers_alarms(struct pwr *pwr, struct eemdev *ed, bool mains_alarm)
 	    if (!strncmp(dev->id, "02", 2)
 		    && strncmp(dev->id + 2, "00", 2)
 		    && (di = dev->data.di_value)) {
-		if (di[2] | di[16]) {
+		if (eem_bits_any(di, &rect_fail)) {
 		    fail_count++;
 		}
-		if (di[4] | di[12]) {
-		    mains_alarm = true;
-		}
-		if (di[6]) {
-		    ov_alarm = true;
-		}
-		if (di[8]) {
-		    ht_alarm = true;
-		}
-		is_rect_acin_nan = (ai = dev->data.ai_value) && isnanf(ai[4]);
-		if (!(di[14] || // not Rectifier Communication Fail
-		  (is_rect_acin_nan && !di[0]))){ //Input AC Voltage NaN and rectifier in slot
+		is_rect_acin_nan = (ai = dev->data.ai_value) && isnanf(ai[EEM_RECTIFIER_AI_INPUT_AC_VOLTAGE]);
+		if (!(eem_bit(di, EEM_RECTIFIER_DI_RECTIFIER_COMMUNICATION_FAIL) || // not Rectifier Communication Fail
+		  (is_rect_acin_nan && !eem_bit(di, EEM_RECTIFIER_DI_RECTIFIER_ON_OFF)))){ //Input AC Voltage NaN and rectifier in slot
 		    lost_count--;
 		}
-		if (di[18]) {
-		    limit_alarm = true;
-		}
-		if (di[20]) {
-		    fan_alarm = true;
-		}
+		/* Group alarms are raised if any rectifier has the flag */
+		eem_bits_or(&seen, &seen, di);
 	    }
 	}
+	if (eem_bit(&seen, EEM_RECTIFIER_DI_MAINS_FAILURE)
+	    | eem_bit(&seen, EEM_RECTIFIER_DI_RECTIFIER_AC_FAULT)) {
+	    mains_alarm = true;
+	}
+	ov_alarm = eem_bit(&seen, EEM_RECTIFIER_DI_OVER_VOLTAGE);
+	ht_alarm = eem_bit(&seen, EEM_RECTIFIER_DI_HIGH_TEMPERATURE);
+	limit_alarm = eem_bit(&seen, EEM_RECTIFIER_DI_POWER_LIMIT);
+	fan_alarm = eem_bit(&seen, EEM_RECTIFIER_DI_FAN_FAILURE);
 
 	// FAIL Alarm Entry
 	pwr_rectifiers_fail_alarm(pwr, ed->pwrp, pwr->in_count, fail_count);
@@ -1646,7 +2520,7 @@ eem_rectifiers_alarms(struct pwr *pwr, struct eemdev *ed, bool mains_alarm)
 }
 
 static void
-eemdev_read_rectifier_group(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_rectifier_group(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_out *out;
     float *ai, *ao;
@@ -1658,23 +2532,23 @@ eemdev_read_rectifier_group(struct pwr *pwr, struct eemdev *ed)
 	ed->pwrp = out;
     }
     if ((ai = ed->data.ai_value)) {
-	out->voltage = ai[0];
-	out->current = ai[1];
+	out->voltage = ai[EEM_RECTIFIER_GROUP_AI_VOLTAGE];
+	out->current = ai[EEM_RECTIFIER_GROUP_AI_CURRENT];
 	out->power = NAN;
-	pwr->in_count = ai[5];
+	pwr->in_count = ai[EEM_RECTIFIER_GROUP_AI_NUMBER_OF_RECTIFIERS];
 	out->enabled = true;
     }
     if ((ao = ed->data.ao_value)) {
-	pwr->input_current_limit = ao[1];
+	pwr->input_current_limit = ao[EEM_RECTIFIER_GROUP_AO_INPUT_CURRENT_LIMIT];
     }
     pwr->fail_count = eem_faulty_rectifiers(ed->eem);
 }
 
 static void
-eemdev_read_rectifier(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_rectifier(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_in *in;
-    uint8_t *di;
+    const eem_bits_t *di;
     float *ai;
     if (!(in = ed->pwrp)) {
 	if (!(in = pwr_in_new(pwr, ed->id))) {
@@ -1682,17 +2556,24 @@ eemdev_read_rectifier(struct pwr *pwr, struct eemdev *ed)
 	}
 	ed->pwrp = in;
     }
+    if (!(dirty & (EEM_DIRTY_AI | EEM_DIRTY_DI))) {
+	/* Same reply as last time, only the liveness is news */
+	if (in->active) {
+	    in->last_seen = time(NULL);
+	}
+	return;
+    }
     if ((ai = ed->data.ai_value) &&
             (di = ed->data.di_value)) {
-	in->active = (!(di[4])      // Rectifier Mains failure
-	        && !di[14]);        // Communication fail
-	in->output.voltage = ai[0];
-	in->output.current = ai[1];
+	in->active = (!eem_bit(di, EEM_RECTIFIER_DI_MAINS_FAILURE)
+	        && !eem_bit(di, EEM_RECTIFIER_DI_RECTIFIER_COMMUNICATION_FAIL));
+	in->output.voltage = ai[EEM_RECTIFIER_AI_VOLTAGE];
+	in->output.current = ai[EEM_RECTIFIER_AI_CURRENT];
 	in->output.power = NAN;
-	in->temperature = ai[2];
-	in->utilization = ai[3];
-	in->input.voltage = ai[4];
-	in->run_time = lrintf(3600 * ai[5]);
+	in->temperature = ai[EEM_RECTIFIER_AI_TEMPERATURE];
+	in->utilization = ai[EEM_RECTIFIER_AI_USED_CAPACITY];
+	in->input.voltage = ai[EEM_RECTIFIER_AI_INPUT_AC_VOLTAGE];
+	in->run_time = lrintf(3600 * ai[EEM_RECTIFIER_AI_TOTAL_RUNNING_TIME]);
 	if(in->active) {
 	    in->last_seen = time(NULL);
 	}
@@ -1700,11 +2581,11 @@ eemdev_read_rectifier(struct pwr *pwr, struct eemdev *ed)
 }
 
 static void
-eemdev_read_battery_group(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_battery_group(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_bat *bat;
     float *ai, *ao;
-    uint8_t *di;
+    const eem_bits_t *di;
     bool test_running = false;
 
     if (!(bat = ed->pwrp)) {
@@ -1714,23 +2595,27 @@ eemdev_read_battery_group(struct pwr *pwr, struct eemdev *ed)
 	ed->pwrp = bat;
     }
     if (!pwr_type_ncu(pwr) && (ai = ed->data.ai_value)) {
-	pwr->bat_temperature = ai[2];
+	pwr->bat_temperature = ai[EEM_BATTERY_GROUP_AI_TEMPERATURE];
     }
     if ((ao = ed->data.ao_value) && pwr) {
-	pwr->device_config.f[bat_charge_curr_max] = ao[7];
-	pwr->device_config.f[bat_boost_charge_voltage] = ao[8];
-	pwr->device_config.f[bat_nominal_capacity] = 3600 * ao[18];
+	pwr->device_config.f[bat_charge_curr_max] = ao[EEM_BATTERY_GROUP_AO_BATTERY_CURRENT_LIMIT];
+	pwr->device_config.f[bat_boost_charge_voltage] = ao[EEM_BATTERY_GROUP_AO_BATTERY_BOOST_CHARGE_VOLTAGE];
+	pwr->device_config.f[bat_nominal_capacity] = 3600 * ao[EEM_BATTERY_GROUP_AO_NOMINAL_BATTERY_CAPACITY];
     }
     if ((di = ed->data.di_value)) {
-        bat->boost_charge = (di[14] | di[16] | di[18]);
-        test_running = (di[8] | di[10] | di[12]);
+        bat->boost_charge = (eem_bit(di, EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_BOOST_CHARGE)
+            | eem_bit(di, EEM_BATTERY_GROUP_DI_CYCLIC_BATTERY_BOOST_CHARGE_RUNNING)
+            | eem_bit(di, EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_BOOST_CHARGE_RUNNING));
+        test_running = (eem_bit(di, EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_TEST_RUNNING)
+            | eem_bit(di, EEM_BATTERY_GROUP_DI_SCHEDULE_BATTERY_TEST_RUNNING)
+            | eem_bit(di, EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_TEST_RUNNING));
     }
     pwr_mode_set(pwr, (test_running ? PWR_MODE_TEST :
             (bat->boost_charge ? PWR_MODE_BOOST : PWR_MODE_FLOAT)));
 }
 
 static void
-eemdev_read_battery(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_battery(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_bat *bat;
     struct bat *batt;
@@ -1746,13 +2631,13 @@ eemdev_read_battery(struct pwr *pwr, struct eemdev *ed)
 	ed->pwrp = bat;
     }
     if ((ai = ed->data.ai_value)) {
-	pwr->bat_voltage = ai[0];
+	pwr->bat_voltage = ai[EEM_BATTERY_UNIT_AI_VOLTAGE];
 	if(!isnanf(pwr->bat_current) &&
-	        !isnanf(ai[1])) {
+	        !isnanf(ai[EEM_BATTERY_UNIT_AI_BATTERY_CURRENT])) {
 	    if ((batt = pwr_bat_get(pwr))) {
 	        curr_resolution = batt->current_resolution;
 	    }
-	    curr_neg = (ai[1] < -curr_resolution);
+	    curr_neg = (ai[EEM_BATTERY_UNIT_AI_BATTERY_CURRENT] < -curr_resolution);
 	    if((ap = find_alarm_from_ins(pwr->ins)) &&
 	            ap->eventType == equipmentAlarm &&
 	            !strcmp(ap->specificProblem, "Battery Discharging")) {
@@ -1762,14 +2647,14 @@ eemdev_read_battery(struct pwr *pwr, struct eemdev *ed)
 	        pwr_alarm(pwr, PWR_BAT_DISCHARGE, 0, warning, curr_neg);
 	    }
 	}
-	pwr->bat_current = bat->current = ai[1];
+	pwr->bat_current = bat->current = ai[EEM_BATTERY_UNIT_AI_BATTERY_CURRENT];
     } else {
 	pwr->bat_voltage = NAN;
 	pwr->bat_current = NAN;
 	pwr->bat_temperature = NAN;
     }
-    if ((ao = ed->data.ao_value) && ao[0]) {
-        pwr->device_config.f[bat_nominal_capacity] = 3600 * ao[0];
+    if ((ao = ed->data.ao_value) && ao[EEM_BATTERY_UNIT_AO_NOMINAL_BATTERY_CAPACITY]) {
+        pwr->device_config.f[bat_nominal_capacity] = 3600 * ao[EEM_BATTERY_UNIT_AO_NOMINAL_BATTERY_CAPACITY];
     }
     if (!pwr_type_ncu(pwr)) {
         temp = pwr->bat_temperature;
@@ -1778,22 +2663,22 @@ eemdev_read_battery(struct pwr *pwr, struct eemdev *ed)
 }
 
 static void
-eemdev_read_lvd_group(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_lvd_group(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     float *ao;
     if (pwr) {
         if ((ao = ed->data.ao_value)) {
-            pwr->device_config.f[bat_high_temp_major]=ao[8];
-            pwr->device_config.f[bat_high_temp_minor]=ao[9];
+            pwr->device_config.f[bat_high_temp_major]=ao[EEM_LVD_GROUP_AO_HIGH_TEMP_DISCONNECT_LEVEL];
+            pwr->device_config.f[bat_high_temp_minor]=ao[EEM_LVD_GROUP_AO_HIGH_TEMP_RECONNECT_LEVEL];
         }
     }
 }
 
 static void
-eemdev_read_lvd_unit(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_lvd_unit(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     float *ao;
-    uint8_t *d, *di;
+    const eem_bits_t *d, *di;
     struct eem *e;
     struct loadD *ld;
     uint32_t cont_id = 0;
@@ -1812,20 +2697,20 @@ eemdev_read_lvd_unit(struct pwr *pwr, struct eemdev *ed)
     if ((ao = ed->data.ao_value)) {
         switch (cont_id) {
         case MAIN_LD_CONID:
-            pwr->device_config.f[dc_load_disconnect_time1] = ao[0];
-            pwr->device_config.f[dc_load_disconnect_volt1] = ao[1];
-            pwr->device_config.f[dc_load_reconnect_volt1] = ao[3];
+            pwr->device_config.f[dc_load_disconnect_time1] = ao[EEM_LVD_UNIT_AO_LVD_TIME];
+            pwr->device_config.f[dc_load_disconnect_volt1] = ao[EEM_LVD_UNIT_AO_LVD_VOLTAGE];
+            pwr->device_config.f[dc_load_reconnect_volt1] = ao[EEM_LVD_UNIT_AO_LVD_RECONNECT_VOLTAGE];
             break;
         case PRIO_LD_CONID:
-            pwr->device_config.f[dc_load_disconnect_time2] = ao[0];
-            pwr->device_config.f[dc_load_disconnect_volt2] = ao[1];
-            pwr->device_config.f[dc_load_reconnect_volt2] = ao[3];
+            pwr->device_config.f[dc_load_disconnect_time2] = ao[EEM_LVD_UNIT_AO_LVD_TIME];
+            pwr->device_config.f[dc_load_disconnect_volt2] = ao[EEM_LVD_UNIT_AO_LVD_VOLTAGE];
+            pwr->device_config.f[dc_load_reconnect_volt2] = ao[EEM_LVD_UNIT_AO_LVD_RECONNECT_VOLTAGE];
             break;
         case BLVD_LD_CONID:
             // Time currently not in use
-            pwr->device_config.f[bat_disconnect_time] = ao[0];
-            pwr->device_config.f[bat_disconnect_voltage] = ao[1];
-            pwr->device_config.f[bat_reconnect_voltage] = ao[3];
+            pwr->device_config.f[bat_disconnect_time] = ao[EEM_LVD_UNIT_AO_LVD_TIME];
+            pwr->device_config.f[bat_disconnect_voltage] = ao[EEM_LVD_UNIT_AO_LVD_VOLTAGE];
+            pwr->device_config.f[bat_reconnect_voltage] = ao[EEM_LVD_UNIT_AO_LVD_RECONNECT_VOLTAGE];
             break;
         }
     }
@@ -1834,19 +2719,19 @@ eemdev_read_lvd_unit(struct pwr *pwr, struct eemdev *ed)
         return;
     }
     if ((di = ed->data.di_value)) {
-        if (di[0]) {
+        if (eem_bit(di, EEM_LVD_UNIT_DI_LVD_DISCONNECTED)) {
             ld->cont_state = ContactorOFF;
         } else {
             ld->cont_state = ContactorON;
         }
     }
     if ((d = ed->data.do_value)) {
-        if (d[0]) {
+        if (eem_bit(d, EEM_LVD_UNIT_DO_LVD_ENABLE)) {
             ld->llvd_en = true;
         } else {
             ld->llvd_en = false;
         }
-        if (!d[2]) {
+        if (!eem_bit(d, EEM_LVD_UNIT_DO_LVD_MODE)) {
             ld->dm = BatteryVoltage;
         } else {
             ld->dm = Time;
@@ -1862,7 +2747,8 @@ eem_solar_count(struct pwr *pwr)
     int count = 0;
     list_for_each_entry (ed, &e->device, list) {
 	if (!strncmp(ed->id, SOLAR_PREFIX, sizeof SOLAR_PREFIX)
-	    && strncmp(ed->id, SOLAR_GROUP_ID, sizeof SOLAR_GROUP_ID)) {
+	    && strncmp(ed->id, SOLAR_GROUP_ID, sizeof SOLAR_GROUP_ID)
+	    && !ed->stale) {
 	    count++;
 	}
     }
@@ -1873,8 +2759,9 @@ static const char *
 eem_solar_lost(MO_instance *ins, void *arg)
 {
     struct pwr *pwr = arg;
+    struct eemdev *ed;
     if (ins->class_index == SolarConverter_index) {
-	if (!eemdev_find(pwr->internal, ins->instanceId)) {
+	if (!(ed = eemdev_find(pwr->internal, ins->instanceId)) || ed->stale) {
 	    MO_alarm(LICENSE_SOLAR, ins, LOST, true);
 	}
     }
@@ -1882,11 +2769,11 @@ eem_solar_lost(MO_instance *ins, void *arg)
 }
 
 static void
-eemdev_read_solar_converter_group(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_solar_converter_group(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_out *out;
     float *ai;
-    uint8_t *di;
+    const eem_bits_t *di;
     if (!(out = ed->pwrp)) {
 	if (!(out = pwr_out_new(pwr, ed->id))) {
 	    return;
@@ -1894,25 +2781,25 @@ eemdev_read_solar_converter_group(struct pwr *pwr, struct eemdev *ed)
 	ed->pwrp = out;
     }
     if ((ai = ed->data.ai_value)) {
-	out->voltage = ai[0];
-	out->current = ai[1];
+	out->voltage = ai[EEM_SOLAR_CONVERTER_GROUP_AI_VOLTAGE];
+	out->current = ai[EEM_SOLAR_CONVERTER_GROUP_AI_CURRENT];
 	out->power = NAN;
-	if (eem_solar_count(pwr) != ai[5]) {
+	if (eem_solar_count(pwr) != ai[EEM_SOLAR_CONVERTER_GROUP_AI_NUMBER_OF_CONVERTERS]) {
 	    MO_traverse(false, NULL, eem_solar_lost, pwr);
 	}
     }
     if ((di = ed->data.di_value)) {
-        out->enabled = !(di[12]);
+        out->enabled = !eem_bit(di, EEM_SOLAR_CONVERTER_GROUP_DI_LOCAL_COMMUNICATION_FAILURE);
     }
 }
 
 static void
-eemdev_read_solar_converter(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_solar_converter(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     struct pwr_in *in;
     MO_instance *ins;
     float *ai;
-    uint8_t *di;
+    const eem_bits_t *di;
     if (!(in = ed->pwrp)) {
 	if (!(in = pwr_in_new(pwr, ed->id))) {
 	    return;
@@ -1920,14 +2807,14 @@ eemdev_read_solar_converter(struct pwr *pwr, struct eemdev *ed)
 	ed->pwrp = in;
     }
     if ((ai = ed->data.ai_value)) {
-	in->output.voltage = ai[0];
-	in->output.current = ai[1];
+	in->output.voltage = ai[EEM_SOLAR_CONVERTER_AI_VOLTAGE];
+	in->output.current = ai[EEM_SOLAR_CONVERTER_AI_CURRENT];
 	in->output.power = NAN;
-	in->run_time = lrintf(3600 * ai[5]);
-	in->input.voltage = ai[7];
-	in->input.current = ai[8];
-	in->temperature = ai[9];
-	in->utilization = ai[10];
+	in->run_time = lrintf(3600 * ai[EEM_SOLAR_CONVERTER_AI_TOTAL_RUNNING_TIME]);
+	in->input.voltage = ai[EEM_SOLAR_CONVERTER_AI_INPUT_VOLTAGE];
+	in->input.current = ai[EEM_SOLAR_CONVERTER_AI_INPUT_CURRENT];
+	in->temperature = ai[EEM_SOLAR_CONVERTER_AI_TEMPERATURE];
+	in->utilization = ai[EEM_SOLAR_CONVERTER_AI_OUTPUT_CAPACITY];
 	if (in->output.current > 0.1
 	    && !in->alarm[PWR_IN_LOST].active
 	    && (ins = MO_getref(&in->ins))) {
@@ -1935,14 +2822,14 @@ eemdev_read_solar_converter(struct pwr *pwr, struct eemdev *ed)
 	}
     }
     if ((di = ed->data.di_value)) {
-	in->active = !(di[0]);
-	in->failed = di[2];
-	in->comm_fail = di[14];
+	in->active = !eem_bit(di, EEM_SOLAR_CONVERTER_DI_CONVERTER_ON_OFF);
+	in->failed = eem_bit(di, EEM_SOLAR_CONVERTER_DI_CONVERTER_FAILURE);
+	in->comm_fail = eem_bit(di, EEM_SOLAR_CONVERTER_DI_CONVERTER_COMMUNICATION_FAIL);
     }
 }
 
 static void
-eemdev_read_dcdistribution_group(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_dcdistribution_group(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     uint8_t i;
     struct dc* dc = NULL;
@@ -1964,14 +2851,14 @@ eemdev_read_dcdistribution_group(struct pwr *pwr, struct eemdev *ed)
             else { /*not defined*/ }
             if ((dcm_ins = MO_findChild(parent, DCMeter_index, id))
                     && (dc = MO_private(dcm_ins))) {
-                dc->voltage = ai[0];
+                dc->voltage = ai[EEM_DC_DISTRIBUTION_GROUP_AI_VOLTAGE];
             }
         }
     }
 }
 
 static void
-eemdev_read_eib_distribution_unit(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_eib_distribution_unit(struct pwr *pwr, struct eemdev *ed, unsigned dirty)
 {
     float *ai;
     int i;
@@ -2003,7 +2890,8 @@ eemdev_read_eib_distribution_unit(struct pwr *pwr, struct eemdev *ed)
     }
 }
 
-typedef void eemdev_read_callback_t(struct pwr *, struct eemdev *);
+/* dirty holds the EEM_DIRTY_* fields that changed since the last reply */
+typedef void eemdev_read_callback_t(struct pwr *, struct eemdev *, unsigned dirty);
 
 eemdev_read_callback_t *eemdev_read_callback[] = {
     eemdev_read_system,
@@ -2026,10 +2914,80 @@ eemdev_read_callback_t *eemdev_read_callback[] = {
     NULL,           /* SM IO IB2 */
 };
 
-static void
-eem_rb(char *buf, size_t len, void *arg)
+/**
+ * @brief Decode the value fields of an RB reply that changed since the last
+ * @param ed	Device the reply is from
+ * @param device	Its block layout
+ * @param s	Reply from <Analog in> on
+ * @return	EEM_DIRTY_* of the fields with a value decoded anew
+ *
+ * The text of the fields is kept in ed->raw. Most replies are the same as
+ * the one before, so each field is first compared with its previous text
+ * and only what differs is decoded; eemdev_datafree() drops the text
+ * together with the values.
+ */
+static unsigned
+eemdev_decode(struct eemdev *ed, const struct eem_device *device,
+	      const char *s)
+{
+    const char *old[EEM_RB_VALUE_FIELDS] = {NULL};
+    size_t old_len[EEM_RB_VALUE_FIELDS] = {0};
+    const char *start = s;
+    const char *p;
+    unsigned dirty = 0;
+    bool changed;
+    size_t len;
+    char *raw;
+    int i;
+
+    for (i = 0, p = ed->raw; p && i < EEM_RB_VALUE_FIELDS; i++) {
+	old[i] = p;
+	old_len[i] = strcspn(p, eem_field_delim);
+	p += old_len[i];
+	if (*p == '!') {
+	    p++;
+	}
+    }
+    changed = false;
+    s = eem_getfloat_delta(s, old[0], old_len[0], device->ai_count,
+			   &ed->data.ai_value, &changed);
+    dirty |= changed ? EEM_DIRTY_AI : 0;
+    changed = false;
+    s = eem_getfloat_delta(s, old[1], old_len[1], device->ao_count,
+			   &ed->data.ao_value, &changed);
+    dirty |= changed ? EEM_DIRTY_AO : 0;
+    changed = false;
+    s = eem_getbit_delta(s, old[2], old_len[2], device->di_count,
+			 &ed->data.di_value, &changed);
+    dirty |= changed ? EEM_DIRTY_DI : 0;
+    changed = false;
+    eem_getbit_delta(s, old[3], old_len[3], device->do_count,
+		     &ed->data.do_value, &changed);
+    dirty |= changed ? EEM_DIRTY_DO : 0;
+
+    len = strcspn(start, "*");
+    if (len >= ed->raw_size) {
+	if (!(raw = realloc(ed->raw, len + 1))) {
+	    free(ed->raw);
+	    ed->raw = NULL;
+	    ed->raw_size = 0;
+	    return dirty;
+	}
+	ed->raw = raw;
+	ed->raw_size = len + 1;
+    }
+    memcpy(ed->raw, start, len);
+    ed->raw[len] = '\0';
+    return dirty;
+}
+
+/**
+ * @brief Take in an RB reply of ed
+ * @return	true if the reply was decoded into ed->data
+ */
+static bool
+eemdev_update(struct eemdev *ed, char *buf, size_t len)
 {
-    struct eemdev *ed = arg;
     struct eem *e;
     struct pwr *pwr;
     const struct eem_device *device;
@@ -2040,67 +2998,158 @@ eem_rb(char *buf, size_t len, void *arg)
     uint16_t i;
     float *ai;
     float *ao;
-    uint8_t *d;
+    const eem_bits_t *d;
+    unsigned dirty;
+    uint64_t hash;
     e = ed->eem;
     pwr = e->pwr;
 
     if (!buf || prefix(buf, "ERR")) { /* Timeout or error */
 	eemdev_datafree(ed);
-	goto next;
+	return false;
     }
     eem_dump(e, buf, len);
     s = eem_getstr(buf, tmp, sizeof tmp); /* Get device ID */
     if (strlen(tmp) < IDLEN - 1
 	|| eemdev_cmp(ed, tmp)) {
 	eem_printf("%s: Reply from wrong device\n", __func__);
-	goto next;
+	return false;
     }
     id = eem_getid(tmp);
     if (id == EEM_UNKNOWN) {
-	goto next;
+	return false;
     }
     device = &eem_blocks[id];
-    /* Get <Status register> from string (UNUSED) */
+    /* Get <Status register> from string, only to see that it changed */
     s = eem_getstr(s, tmp, sizeof tmp);
-    /* Get <Analog in> from string */
-    s = eem_getfloat(s, device->ai_count, &ed->data.ai_value);
-    /* Get <Analog out> from string */
-    s = eem_getfloat(s, device->ao_count, &ed->data.ao_value);
-    /* Get <Digital in> from string */
-    s = eem_getbit(s, device->di_count, &ed->data.di_value);
-    /* Get <Digital out> from string */
-    eem_getbit(s, device->do_count, &ed->data.do_value);
-    if ((ai = ed->data.ai_value)) {
+    if ((hash = eem_fnv(EEM_FNV_INIT, tmp, strlen(tmp))) != ed->status_hash) {
+	ed->status_hash = hash;
+	e->alarm_dirty = true;
+    }
+    /* Get the values that changed from <Analog in> on */
+    dirty = eemdev_decode(ed, device, s);
+    if ((dirty & EEM_DIRTY_AI) && (ai = ed->data.ai_value)) {
 	eem_printf("Analog Inputs (%d):\n", device->ai_count);
 	for (i = 0; i < device->ai_count; i++) {
 	    eem_printf("-[%d] %s: %g\n", i, device->ai_param[i], ai[i]);
 	}
     }
-    if ((ao = ed->data.ao_value)) {
+    if ((dirty & EEM_DIRTY_AO) && (ao = ed->data.ao_value)) {
 	eem_printf("Analog Outputs (%d):\n", device->ao_count);
 	for (i = 0; i < device->ao_count; i++) {
 	    eem_printf("-[%d] %s: %g\n", i, device->ao_param[i], ao[i]);
 	}
     }
-    if ((d = ed->data.di_value)) {
+    if ((dirty & EEM_DIRTY_DI) && (d = ed->data.di_value)) {
 	eem_printf("Digital Inputs (%d):\n", device->di_count);
 	for (i = 0; i < device->di_count; i++) {
 	    eem_printf("-[%d] %s: %s\n", i, device->di_param[i],
-		       d[i] ? "true" : "false");
+		       eem_bit(d, i) ? "true" : "false");
 	}
     }
-    if ((d = ed->data.do_value)) {
+    if ((dirty & EEM_DIRTY_DO) && (d = ed->data.do_value)) {
 	eem_printf("Digital Outputs (%d):\n", device->do_count);
 	for (i = 0; i < device->do_count; i++) {
 	    eem_printf("-[%d] %s: %s\n", i, device->do_param[i],
-		       d[i] ? "true" : "false");
+		       eem_bit(d, i) ? "true" : "false");
 	}
     }
     if ((callback = eemdev_read_callback[id])) {
-	callback(pwr, ed);
+	callback(pwr, ed, dirty);
     }
-next:
-    eemdev_read_next(pwr, ed);
+    return true;
+}
+
+static void
+eem_rb(char *buf, size_t len, void *arg)
+{
+    struct eemdev *ed = arg;
+    /* Gone since it was asked for, its values must stay dropped */
+    if (!ed->stale && !eemdev_update(ed, buf, len)) {
+	ed->next_poll = 0;	/* Try again on the next sweep */
+    }
+    eemdev_read_next(ed->eem->pwr, ed);
+}
+
+/*
+ * Milliseconds between reads of a block of each type, 0 for every sweep.
+ * The values the power system is run on are read every sweep; units
+ * whose readings mostly matter for inventory and trends are read less
+ * often, so the sweep, and the alarm read that ends it, comes round
+ * sooner.
+ */
+static uint32_t eem_poll_ms[EEM_UNKNOWN] = {
+    [EEM_RECTIFIER] = 10000,
+    [EEM_BATTERY_UNIT] = 5000,
+    [EEM_DC_DISTRIBUTION_GROUP] = 5000,
+    [EEM_EIB_DISTRIBUTION_UNIT] = 5000,
+    [EEM_LVD_GROUP] = 10000,
+    [EEM_LVD_UNIT] = 5000,
+    [EEM_SOLAR_CONVERTER] = 10000,
+};
+
+/**
+ * @brief Set how often blocks of a type are read
+ * @param eemid	Block type
+ * @param ms	Milliseconds between reads, 0 to read them every sweep
+ */
+void
+eem_set_poll_interval(eemid_t eemid, uint32_t ms)
+{
+    if (eemid < EEM_UNKNOWN) {
+	eem_poll_ms[eemid] = ms;
+    }
+}
+
+/**
+ * @brief Set how often one device is read, overriding its block type
+ * @param pwr	Power system
+ * @param id	Device ID
+ * @param ms	Milliseconds between reads, EEM_POLL_CLASS to go back to
+ *		the rate of the block type
+ */
+void
+eem_set_device_poll_interval(struct pwr *pwr, const char *id, uint32_t ms)
+{
+    struct eem *e;
+    struct eemdev *ed;
+    if ((e = pwr->internal) && (ed = eemdev_find(e, id))) {
+	ed->poll_ms = ms;
+	ed->next_poll = 0;
+    }
+}
+
+static uint32_t
+eemdev_poll_ms(const struct eemdev *ed)
+{
+    if (ed->poll_ms != EEM_POLL_CLASS) {
+	return ed->poll_ms;
+    }
+    return ed->eemid < EEM_UNKNOWN ? eem_poll_ms[ed->eemid] : 0;
+}
+
+/**
+ * @brief Start the sweep again later, a request of it was refused
+ * @param e	EEM session
+ *
+ * Each read of the sweep is queued by the callback of the one before, so
+ * a read the queue refused would end the sweep, and the alarm reads
+ * behind it, until the next reconnect.
+ */
+static void
+eem_sweep_later(struct eem *e)
+{
+    struct pwr *pwr = e->pwr;
+    eem_printf("sweep deferred\n");
+    e->rb_rq_loop = false;
+    evtimer_sec_add(e->sweep_event, EEM_READ_TIMEOUT);
+}
+
+static void
+eem_sweep_retry(int fd UNUSED, short what UNUSED, void *arg)
+{
+    struct pwr *pwr = arg;
+    eemdev_read_first(pwr->internal);
 }
 
 static void
@@ -2111,10 +3160,16 @@ eemdev_read(struct eemdev *ed)
     struct eem *e = ed->eem;
     if(!e->rb_rq_loop)
         e->rb_rq_loop = true;
+    ed->next_poll = eem_now_ms() + eemdev_poll_ms(ed);
     snprintf(command, sizeof command, "RB%.4s", ed->id);
-    eemr_new(pwr, command, eem_rb, ed);
+    if (!eemr_new(pwr, command, eem_rb, ed)) {
+	ed->next_poll = 0;
+	eem_sweep_later(e);
+    }
 }
 
+static void eemdev_read_after(struct pwr *, struct list_head *);
+
 static void
 eemdev_read_first(struct eem *e)
 {
@@ -2130,7 +3185,9 @@ eemdev_read_first(struct eem *e)
         eem_printf("RB request loop already active");
         return;
     }
-    eemdev_read(list_entry(head->next, struct eemdev, list));
+    e->rb_rq_loop = true;
+    e->sweep_slow = 0;
+    eemdev_read_after(pwr, head);
 }
 
 static void eem_read_alarms(struct pwr *, int);
@@ -2389,21 +3446,45 @@ ncu_snmp_timeout(int fd UNUSED, short what UNUSED, void *arg)
     }
 }
 
+/**
+ * @brief Read the next device due after pos, or end the sweep
+ * @param pwr	Power system
+ * @param pos	Device read last, or the list head to start a sweep
+ *
+ * A device is due once its interval has passed since it was last read,
+ * so each sweep reads the fast blocks and whichever slow ones are due,
+ * in list order. No more than EEM_POLL_SLOW_MAX slow ones are read per
+ * sweep: when many fall due together, the rest wait for the next sweep
+ * rather than hold up the fast blocks.
+ */
 static void
-eemdev_read_next(struct pwr *pwr, struct eemdev *ed)
+eemdev_read_after(struct pwr *pwr, struct list_head *pos)
 {
     struct eem *e = pwr->internal;
-    while (!list_is_last(&ed->list, &e->device)) {
-	ed = list_entry(ed->list.next, struct eemdev, list);
+    struct eemdev *ed;
+    uint64_t now = eem_now_ms();
+    while (pos->next != &e->device) {
+	pos = pos->next;
+	ed = list_entry(pos, struct eemdev, list);
 	if (ed->eemid == EEM_EIB_DISTRIBUTION_UNIT
 	        && !pwr_type_ncu(pwr)) {
 	    continue;
 	}
-	if (ed->eemid != EEM_UNKNOWN
-	    && eemdev_read_callback[ed->eemid]) {
-	    eemdev_read(ed);
-	    return;
+	if (ed->eemid == EEM_UNKNOWN
+	    || !eemdev_read_callback[ed->eemid]
+	    || ed->stale
+	    || ed->next_poll > now) {
+	    continue;
+	}
+	/* A device not read yet is not held back */
+	if (eemdev_poll_ms(ed) && ed->data.ai_value) {
+	    if (e->sweep_slow >= EEM_POLL_SLOW_MAX) {
+		continue;
+	    }
+	    e->sweep_slow++;
 	}
+	eemdev_read(ed);
+	return;
     }
     pwr_update(pwr);
     pwr_alarm_start(pwr);
@@ -2417,6 +3498,12 @@ eemdev_read_next(struct pwr *pwr, struct eemdev *ed)
     eem_read_alarms(pwr, 0);
 }
 
+static void
+eemdev_read_next(struct pwr *pwr, struct eemdev *ed)
+{
+    eemdev_read_after(pwr, &ed->list);
+}
+
 #ifdef EEM_ALARMSIM
 static struct eemdev *
 eemdev_find_id(struct eem *e, eemid_t id)
@@ -2431,10 +3518,32 @@ eemdev_find_id(struct eem *e, eemid_t id)
 }
 #endif
 
-static void
-eem_rc(char *buf, size_t len, void *arg)
+static bool eem_rc_shortcut = true;
+
+/**
+ * @brief Choose whether an unchanged alarm list is read in full
+ * @param on	true to take the pages after the first from the last full
+ *		read while the first page and the status registers of the
+ *		blocks stay the same, for at most EEM_RC_RESYNC seconds
+ */
+void
+eem_set_rc_shortcut(bool on)
+{
+    eem_rc_shortcut = on;
+}
+
+/**
+ * @brief Raise the alarms of one page of the alarm list
+ * @param pwr	Power system
+ * @param buf	RC reply, NUL terminated at len
+ * @param start	Set to the index of the first alarm of the page
+ * @param end	Set to the index past its last alarm
+ * @return	false when buf is not a page of alarms
+ */
+static bool
+eem_rc_page(struct pwr *pwr, char *buf, size_t len, uint8_t *startp,
+	    uint8_t *endp)
 {
-    struct pwr *pwr = arg;
     struct eem *e = pwr->internal;
     struct eemdev *ed;
     const struct eem_alarm *al;
@@ -2453,15 +3562,10 @@ eem_rc(char *buf, size_t len, void *arg)
     pwr_alarm_t type;
     pwr_in_alarm_t type_in;
     uint16_t bit;
-    float t;
     bool rectgr_alarm_mains = false;
-    if (!buf) {
-	goto out;
-    }
-    eem_dump(e, buf, len);
     if (!(pa = memchr(buf, '#', len))
 	|| (ul = strtoul(buf, NULL, 16)) > 0xFF) {
-	goto clear;
+	return false;
     }
     start = block = ul;
     buf[len] = '\0';
@@ -2569,55 +3673,159 @@ def:        pwr_alarm(e->pwr, type, bit, severity, true);
 	    eem_rectifiers_alarms(pwr, ed, rectgr_alarm_mains);
 	}
     }
+    *startp = start;
+    *endp = block;
+    return true;
+}
+
+/**
+ * @brief Note an RC page of a full read of the alarm list
+ *
+ * The first page starts a new read; the pages after it are kept so an
+ * unchanged list can be taken in again without paging through it.
+ */
+static void
+eem_rc_keep(struct eem *e, uint8_t start, const char *buf, size_t len)
+{
+    char *p;
+    size_t size;
+    if (!start) {
+	e->rc_first_hash = eem_fnv(EEM_FNV_INIT, buf, len);
+	e->rc_pages_len = 0;
+	e->rc_valid = false;
+	e->alarm_dirty = false;
+	return;
+    }
+    if (e->rc_pages_len + len + 1 > e->rc_pages_size) {
+	size = 2 * e->rc_pages_size + len + 1;
+	if (!(p = realloc(e->rc_pages, size))) {
+	    /* Not reusable, read the next list in full */
+	    e->alarm_dirty = true;
+	    return;
+	}
+	e->rc_pages = p;
+	e->rc_pages_size = size;
+    }
+    memcpy(e->rc_pages + e->rc_pages_len, buf, len);
+    e->rc_pages[e->rc_pages_len + len] = '\0';
+    e->rc_pages_len += len + 1;
+}
+
+/**
+ * @brief Whether the rest of the alarm list can be taken from the last
+ * full read, given its first page
+ */
+static bool
+eem_rc_unchanged(struct eem *e, const char *buf, size_t len)
+{
+    return eem_rc_shortcut && e->rc_valid && !e->alarm_dirty
+	&& time_monotonic() - e->rc_full_time < EEM_RC_RESYNC
+	&& eem_fnv(EEM_FNV_INIT, buf, len) == e->rc_first_hash;
+}
+
+/**
+ * @brief Raise the alarms of the pages kept by eem_rc_keep()
+ */
+static void
+eem_rc_replay(struct pwr *pwr)
+{
+    struct eem *e = pwr->internal;
+    uint8_t start;
+    uint8_t end;
+    size_t n;
+    char *p;
+    for (p = e->rc_pages; p < e->rc_pages + e->rc_pages_len; p += n + 1) {
+	n = strlen(p);
+	eem_rc_page(pwr, p, n, &start, &end);
+    }
+}
+
+static void
+eem_rc(char *buf, size_t len, void *arg)
+{
+    struct pwr *pwr = arg;
+    struct eem *e = pwr->internal;
+#ifdef EEM_ALARMSIM
+    struct eemdev *ed;
+    const struct eem_alarm *al;
+    perceivedSeverity_t severity;
+    ulong alarm_index;
+    eemid_t eemid;
+    pwr_alarm_t type;
+    uint16_t bit;
+#endif
+    uint8_t start;
+    uint8_t block;
+    float t;
+    if (!buf) {
+	e->rc_valid = false;
+	goto out;
+    }
+    eem_dump(e, buf, len);
+    buf[len] = '\0';
+    if (!eem_rc_page(pwr, buf, len, &start, &block)) {
+	e->rc_valid = false;
+	goto clear;
+    }
     if (block - start > 9) {
-	eem_read_alarms(pwr, block);
-    } else { /* Finished reading alarm list */
+	if (start || !eem_rc_unchanged(e, buf, len)) {
+	    eem_rc_keep(e, start, buf, len);
+	    eem_read_alarms(pwr, block);
+	    return;
+	}
+	/* First page and status registers as before: reuse the rest */
+	eem_rc_replay(pwr);
+    } else {
+	eem_rc_keep(e, start, buf, len);
+	e->rc_valid = true;
+	e->rc_full_time = time_monotonic();
+    }
+    /* Finished reading alarm list */
 #ifdef EEM_ALARMSIM
-	uint32_t r;
-	size_t count;
-	int i;
-	for (i = 0; i < 10; i++) {
-	    r = random();
-	    severity = eem_severity[r % MAXCOUNT(eem_severity)];
-	    r /= MAXCOUNT(eem_severity);
-	    eemid = r % MAXCOUNT(eem_ae);
-	    r /= MAXCOUNT(eem_ae);
-	    if (!(count = eem_ae[eemid].count)) {
-		continue;
-	    }
-	    alarm_index = r % count;
-	    r /= count;
-	    if ((ed = eemdev_find_id(e, eemid))) {
-		al = &eem_ae[eemid].ae[alarm_index];
-		type = al->u.type;
-		bit = al->bit;
-		switch (eemid) {
-		case EEM_RECTIFIER:
-		case EEM_SOLAR_CONVERTER:
-		    pwr_in_alarm(e->pwr, ed->pwrp, al->u.in_type, bit,
-				 severity, true);
-		    break;
-		case EEM_RECTIFIER_GROUP:
-		case EEM_SOLAR_CONVERTER_GROUP:
-		case EEM_LVD_UNIT:
-		    pwr_out_alarm(e->pwr, ed->pwrp, al->u.out_type, bit,
-				  severity, true);
-		    break;
-		default:
-		    pwr_alarm(e->pwr, type, bit, severity, true);
-		    break;
-		}
+    uint32_t r;
+    size_t count;
+    int i;
+    for (i = 0; i < 10; i++) {
+	r = random();
+	severity = eem_severity[r % MAXCOUNT(eem_severity)];
+	r /= MAXCOUNT(eem_severity);
+	eemid = r % MAXCOUNT(eem_ae);
+	r /= MAXCOUNT(eem_ae);
+	if (!(count = eem_ae[eemid].count)) {
+	    continue;
+	}
+	alarm_index = r % count;
+	r /= count;
+	if ((ed = eemdev_find_id(e, eemid))) {
+	    al = &eem_ae[eemid].ae[alarm_index];
+	    type = al->u.type;
+	    bit = al->bit;
+	    switch (eemid) {
+	    case EEM_RECTIFIER:
+	    case EEM_SOLAR_CONVERTER:
+		pwr_in_alarm(e->pwr, ed->pwrp, al->u.in_type, bit,
+			     severity, true);
+		break;
+	    case EEM_RECTIFIER_GROUP:
+	    case EEM_SOLAR_CONVERTER_GROUP:
+	    case EEM_LVD_UNIT:
+		pwr_out_alarm(e->pwr, ed->pwrp, al->u.out_type, bit,
+			      severity, true);
+		break;
+	    default:
+		pwr_alarm(e->pwr, type, bit, severity, true);
+		break;
 	    }
 	}
-#endif
-    clear:
-	pwr_alarm_clear_inactive(pwr);
-    out:
-	t = pwr_time(pwr);
-	pwr->run_time += t;
-	eem_set_blvd_dm(pwr);
-	eemdev_read_first(e);
     }
+#endif
+clear:
+    pwr_alarm_clear_inactive(pwr);
+out:
+    t = pwr_time(pwr);
+    pwr->run_time += t;
+    eem_set_blvd_dm(pwr);
+    eemdev_read_first(e);
 }
 
 static void
@@ -2625,7 +3833,9 @@ eem_read_alarms(struct pwr *pwr, int block)
 {
     char command[5];
     snprintf(command, sizeof command, "RC%02X", block);
-    eemr_new(pwr, command, eem_rc, pwr);
+    if (!eemr_new(pwr, command, eem_rc, pwr)) {
+	eem_sweep_later(pwr->internal);
+    }
 }
 
 static void
@@ -2663,6 +3873,8 @@ eem_open(struct pwr *pwr)
 	e->scan_event = evtimer_new(event_base, eem_scan, pwr);
 	e->event = evtimer_new(event_base, eem_connect_timeout, pwr);
 	e->snmp_event = evtimer_new(event_base, ncu_snmp_timeout, pwr);
+	e->wb_event = evtimer_new(event_base, eem_wb_flush, pwr);
+	e->sweep_event = evtimer_new(event_base, eem_sweep_retry, pwr);
     }
     e->pwr = pwr;
     e->dest = *ap;
@@ -2754,12 +3966,85 @@ eemdata_find(struct pwr *pwr, const char *id)
     return NULL;
 }
 
+/**
+ * @brief Take a flushed write off its block and free it
+ */
+static void
+eem_wb_free(struct eem_wb *wb)
+{
+    struct eem_wb **p;
+    for (p = &wb->ed->wb_sent; *p; p = &(*p)->next) {
+	if (*p == wb) {
+	    *p = wb->next;
+	    break;
+	}
+    }
+    free(wb);
+}
+
+/**
+ * @brief Check the read-back that follows a WB against what was written
+ *
+ * Outputs a newer WB of the block wrote as well are left to its own
+ * read-back.
+ */
+static void
+eem_rb_confirm(char *buf, size_t len, void *arg)
+{
+    struct eem_wb *wb = arg;
+    struct eemdev *ed = wb->ed;
+    struct eem *e = ed->eem;
+    struct pwr *pwr = e->pwr;
+    const struct eem_wb *w;
+    eem_bits_t ao_set = wb->ao_set;
+    eem_bits_t do_set = wb->do_set;
+    const float *ao;
+    const eem_bits_t *d;
+    size_t i;
+    if (!eemdev_update(ed, buf, len)) {
+	eem_wb_free(wb);
+	return;
+    }
+    for (w = ed->wb_sent; w && w != wb; w = w->next) {
+	for (i = 0; i < EEM_BITS_WORDS; i++) {
+	    ao_set.w[i] &= ~w->ao_set.w[i];
+	    do_set.w[i] &= ~w->do_set.w[i];
+	}
+    }
+    if ((ao = ed->data.ao_value)) {
+	for (i = 0; i < wb->na; i++) {
+	    if (eem_bit(&ao_set, i)
+		&& eem_hex_ftou(ao[i]) != eem_hex_ftou(wb->ao[i])) {
+		eem_printf("%s: %.4s AO[%zu] is %g, %g was written\n",
+			   __func__, ed->id, i, ao[i], wb->ao[i]);
+	    }
+	}
+    }
+    if ((d = ed->data.do_value)) {
+	for (i = 0; i < wb->nd; i++) {
+	    if (eem_bit(&do_set, i)
+		&& eem_bit(d, i) != eem_bit(&wb->dout, i)) {
+		eem_printf("%s: %.4s DO[%zu] is %d, %d was written\n",
+			   __func__, ed->id, i, eem_bit(d, i),
+			   eem_bit(&wb->dout, i));
+	    }
+	}
+    }
+    eem_wb_free(wb);
+}
+
+/* Read the block back once the WB was answered */
 static void
 eem_wb(char *buf, size_t len, void *arg)
 {
-    struct eemdev *ed = arg;
+    struct eem_wb *wb = arg;
+    struct eemdev *ed = wb->ed;
+    char command[7];
     eem_dump(ed->eem, buf, len);
-    /* FIX */
+    snprintf(command, sizeof command, "RB%.4s", ed->id);
+    if (!buf || !eemr_new(ed->eem->pwr, command, eem_rb_confirm, wb)) {
+	eem_wb_free(wb);
+    }
 }
 
 static void
@@ -2778,91 +4063,213 @@ eem_command(struct pwr *pwr, const char *buf)
     }
 }
 
-static uint32_t
-eem_ftou(float f)
+/**
+ * @brief Queue a WB with the analog and digital outputs of a block
+ * @param ed	Block to write
+ * @param a	Analog outputs
+ * @param na	Number of analog outputs
+ * @param d	Digital outputs
+ * @param nd	Number of digital outputs
+ * @param wb	Writes the request carries, handed to eem_wb()
+ * @return	false when the request was not queued
+ *
+ * The length of the request is known up front, so it is rendered straight
+ * into the buffer; a request that does not fit is refused, not cut short.
+ */
+static bool
+eem_wb_render(struct eemdev *ed, const float *a, size_t na,
+	      const eem_bits_t *d, size_t nd, struct eem_wb *wb)
 {
-    int32_t m;
-    uint32_t e;
-    union {
-	uint32_t u;
-	float f;
-    } u;
-    uint32_t uh;
-    if (!f) {
-	return 0;
-    }
-    u.f = f;
-    uh = u.u;
-    m = (uh & 0x7FFFFE) | 0x800000;
-    if (f < 0) {
-	m = -m;
-	m &= 0xFFFFFF;
-	m |= 0x1000000;
+    struct eem *e = ed->eem;
+    struct pwr *pwr = e->pwr;
+    char buf[1024];
+    size_t idlen = strnlen(ed->id, IDLEN - 1);
+    size_t len = 2 + idlen + 1 + na * EEM_HEX_DIGITS + 1 + (nd + 3) / 4;
+    char *p = buf;
+    if (len >= sizeof buf) {
+	eem_printf("%s: WB%.4s of %zu bytes does not fit\n", __func__,
+		   ed->id, len);
+	return false;
     }
-    m <<= 7;
-    e = ((uh >> 23) - 126) & 0xFF;
-    return m | e;
+    memcpy(p, "WB", 2);
+    p += 2;
+    memcpy(p, ed->id, idlen);
+    p += idlen;
+    *p++ = '!';
+    p += eem_hex_put_floats(a, na, p);
+    *p++ = '!';
+    p += eem_bits_put_hex(d, nd, p);
+    *p = '\0';
+    return eemr_new(pwr, buf, eem_wb, wb) != NULL;
 }
 
+/**
+ * @brief Send the writes merged for ed as one WB
+ *
+ * Outputs nobody wrote are sent with the values last read.
+ */
 static void
-eem_write(struct eemdev *ed, float *a, size_t na, uint8_t *d, size_t nd)
+eem_wb_send(struct eemdev *ed)
 {
-    char buf[1024];
-    size_t maxlen;
-    size_t len;
+    struct eem *e = ed->eem;
+    struct pwr *pwr = e->pwr;
+    struct eem_wb *wb = ed->wb;
+    const float *ao = ed->data.ao_value;
+    const eem_bits_t *base = ed->data.do_value;
+    float a[EEM_MAX_AO];
+    eem_bits_t d = {{0}};
     size_t i;
-    float f;
-    char *p;
-    uint8_t bit;
-    uint8_t b;
-    len = snprintf(buf, sizeof buf, "WB%.4s!", ed->id);
-    p = buf + len;
-    maxlen = sizeof buf - len;
+    ed->wb = NULL;
+    if (!eem_bits_count(&wb->ao_set) && !eem_bits_count(&wb->do_set)) {
+	/* Every write was undone before the flush */
+	free(wb);
+	return;
+    }
+    if ((wb->na && !ao) || (wb->nd && !base)) {
+	eem_printf("%s: %.4s was not read, write dropped\n", __func__,
+		   ed->id);
+	free(wb);
+	return;
+    }
+    for (i = 0; i < wb->na; i++) {
+	a[i] = eem_bit(&wb->ao_set, i) ? wb->ao[i] : ao[i];
+    }
+    if (wb->nd) {
+	for (i = 0; i < EEM_BITS_WORDS; i++) {
+	    d.w[i] = (base->w[i] & ~wb->do_set.w[i])
+		| (wb->dout.w[i] & wb->do_set.w[i]);
+	}
+    }
+    wb->ed = ed;
+    wb->next = ed->wb_sent;
+    ed->wb_sent = wb;
+    if (!eem_wb_render(ed, a, wb->na, &d, wb->nd, wb)) {
+	eem_wb_free(wb);
+    }
+}
 
+static void
+eem_wb_flush(int fd UNUSED, short what UNUSED, void *arg)
+{
+    struct pwr *pwr = arg;
+    struct eem *e;
+    struct eemdev *ed;
+    if (!(e = pwr->internal)) {
+	return;
+    }
+    list_for_each_entry (ed, &e->device, list) {
+	if (ed->wb) {
+	    eem_wb_send(ed);
+	}
+    }
+}
 
+/**
+ * @brief Stage a write of the analog and digital outputs of a block
+ * @param ed	Block to write
+ * @param a	Analog outputs
+ * @param na	Number of analog outputs
+ * @param d	Digital outputs
+ * @param nd	Number of digital outputs
+ *
+ * The setters each pass the whole vector of the block, built by
+ * eem_wb_ao() or eem_wb_do(), with the values they change. Writes to the
+ * same block are merged until the event loop comes round, then sent as
+ * one WB and read back to confirm. An output counts as written when it
+ * differs from what is staged for it, or else from the value last read;
+ * later writers win, and writing back the value last read drops the
+ * staged write. A vector that is the cache itself, changed in place, is
+ * written whole.
+ */
+static void
+eem_write(struct eemdev *ed, float *a, size_t na, const eem_bits_t *d,
+	  size_t nd)
+{
+    struct eem *e = ed->eem;
+    struct eem_wb *wb;
+    const float *ao = ed->data.ao_value;
+    const eem_bits_t *dout = ed->data.do_value;
+    float ref;
+    bool bit;
+    size_t i;
+    if (na > EEM_MAX_AO || nd > EEM_BITS_MAX || (nd && !d)) {
+	return;
+    }
+    if (!(wb = ed->wb)) {
+	if (!(wb = calloc(1, sizeof *wb))) {
+	    return;
+	}
+	ed->wb = wb;
+	eem_evtimer_ms_add(e->wb_event, 0);
+    }
     for (i = 0; i < na; i++) {
-	f = a[i];
-	if (isnan(f)) {
-	    len = snprintf(p, maxlen, "7FFFFF80");
-	} else {
-	    len = snprintf(p, maxlen, "%08X", eem_ftou(a[i]));
+	if (!ao || a == ao) {
+	    wb->ao[i] = a[i];
+	    eem_bit_set(&wb->ao_set, i, 1);
+	    continue;
 	}
-	if (len >= maxlen) {
-	    return;
+	ref = eem_bit(&wb->ao_set, i) ? wb->ao[i] : ao[i];
+	if (eem_hex_ftou(a[i]) != eem_hex_ftou(ref)) {
+	    wb->ao[i] = a[i];
+	    eem_bit_set(&wb->ao_set, i,
+			eem_hex_ftou(a[i]) != eem_hex_ftou(ao[i]));
 	}
-	p += len;
-	maxlen -= len;
     }
-    *p++ = '!';
-    maxlen--;
-    bit = 0;
-    b = 0;
     for (i = 0; i < nd; i++) {
-	b <<= 1;
-	if (d[i]) {
-	    b |= 1;
+	if (!dout || d == dout) {
+	    eem_bit_set(&wb->dout, i, eem_bit(d, i));
+	    eem_bit_set(&wb->do_set, i, 1);
+	    continue;
 	}
-	if (++bit == 4) {
-	    len = snprintf(p, maxlen, "%X", b);
-	    if (len >= maxlen) {
-		return;
-	    }
-	    p += len;
-	    maxlen -= len;
-	    bit = 0;
-	    b = 0;
+	bit = eem_bit(&wb->do_set, i) ? eem_bit(&wb->dout, i)
+	    : eem_bit(dout, i);
+	if (eem_bit(d, i) != bit) {
+	    eem_bit_set(&wb->dout, i, eem_bit(d, i));
+	    eem_bit_set(&wb->do_set, i, eem_bit(d, i) != eem_bit(dout, i));
 	}
     }
-    if (bit) {
-	b <<= 4 - bit;
-	len = snprintf(p, maxlen, "%X", b);
-	if (len >= maxlen) {
-	    return;
+    if (na > wb->na) {
+	wb->na = na;
+    }
+    if (nd > wb->nd) {
+	wb->nd = nd;
+    }
+}
+
+/**
+ * @brief Copy the analog outputs of a block as the next WB leaves them
+ * @param ed	Block, read at least once
+ * @param f	Room for n values
+ * @param n	Number of values
+ */
+static void
+eem_wb_ao(const struct eemdev *ed, float *f, size_t n)
+{
+    const struct eem_wb *wb = ed->wb;
+    size_t i;
+    memmove(f, ed->data.ao_value, n * sizeof f[0]);
+    for (i = 0; wb && i < n; i++) {
+	if (eem_bit(&wb->ao_set, i)) {
+	    f[i] = wb->ao[i];
 	}
-	p += len;
     }
-    *p = '\0';
-    eemr_new(ed->eem->pwr, buf, eem_wb, ed);
+}
+
+/**
+ * @brief Copy the digital outputs of a block as the next WB leaves them
+ * @param ed	Block, read at least once
+ * @param d	Set to the outputs
+ */
+static void
+eem_wb_do(const struct eemdev *ed, eem_bits_t *d)
+{
+    const struct eem_wb *wb = ed->wb;
+    size_t i;
+    *d = *ed->data.do_value;
+    for (i = 0; wb && i < EEM_BITS_WORDS; i++) {
+	d->w[i] = (d->w[i] & ~wb->do_set.w[i])
+	    | (wb->dout.w[i] & wb->do_set.w[i]);
+    }
 }
 
 /**
@@ -2893,7 +4300,7 @@ eem_set_battery_analog_output(struct pwr *pwr, enum eem_battey_ao_index ao_index
         return;
     }
 
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[ao_index] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -2915,7 +4322,7 @@ eem_set_equalize_charge_stop_delay_time(struct pwr *pwr, float value)
 	|| !(f = alloca(len))) {
 	return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[44] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -2937,7 +4344,7 @@ eem_set_equalize_charge_stop_current(struct pwr *pwr, float value)
 	|| !(f = alloca(len))) {
 	return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[45] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -2959,7 +4366,7 @@ eem_set_cyclic_equalize_charge_interval(struct pwr *pwr, float value)
 	|| !(f = alloca(len))) {
 	return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[14] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -2971,20 +4378,18 @@ eem_set_boost_charge(struct pwr *pwr, bool boost)
     struct eem *e;
     struct eemdev *ed;
     size_t do_count;
-    uint8_t *d, *dout;
-    size_t len;
+    const eem_bits_t *dout;
+    eem_bits_t d;
     if (!(e = pwr->internal)
 	|| !(ed = eemdev_find(e, BATTERY_GROUP_ID))
 	|| !(dout = ed->data.do_value)
-	|| !(do_count = device->do_count)
-	|| (len = do_count * sizeof d[0]) > 4096
-	|| !(d = alloca(len))) {
+	|| !(do_count = device->do_count)) {
 	return;
     }
-    memmove(d, dout, len);
-    d[4] = boost;
-    d[6] = !boost;
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_wb_do(ed, &d);
+    eem_bit_set(&d, 4, boost);
+    eem_bit_set(&d, 6, !boost);
+    eem_write(ed, NULL, 0, &d, do_count);
 }
 
 void
@@ -3004,7 +4409,7 @@ eem_set_boost_voltage(struct pwr *pwr, float value)
     || !(f = alloca(len))) {
     return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[8] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -3026,7 +4431,7 @@ eem_set_charge_curr(struct pwr *pwr, float value)
     || !(f = alloca(len))) {
     return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[7] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -3050,7 +4455,7 @@ eem_set_loadD(struct pwr *pwr, uint8_t idx)
     || !(data = alloca(len))) {
     return;
     }
-    memmove(data, ao, len);
+    eem_wb_ao(ed, data, ao_count);
     if (!isnan(pwr->config.f[dc_load_disconnect_time1 + idx - 1])) {
     data[0] = pwr->config.f[dc_load_disconnect_time1 + idx - 1];
     }
@@ -3084,7 +4489,7 @@ eem_set_blvd(struct pwr *pwr, pwr_config_float_t type, float f)
     || !(data = alloca(len))) {
     return;
     }
-    memmove(data, ao, len);
+    eem_wb_ao(ed, data, ao_count);
     switch (type) {
     case bat_disconnect_time:
         id = 0;
@@ -3109,26 +4514,24 @@ eem_set_blvd_dm(struct pwr *pwr)
     const struct eem_device *device = &eem_blocks[EEM_LVD_UNIT];
     struct eem *e;
     struct eemdev *ed;
-    size_t len;
     size_t do_count;
-    uint8_t *d, *dout;
+    const eem_bits_t *dout;
+    eem_bits_t d;
 
     if (!(e = pwr->internal)
             || !(ed = eemdev_find(e, ssprintf("070%d", BLVD_LD_CONID)))
             || !(dout = ed->data.do_value)
-            || !(do_count = device->do_count)
-            || (len = do_count * sizeof d[0]) > 4096
-            || !(d = alloca(len))) {
+            || !(do_count = device->do_count)) {
         return;
     }
-    memmove(d, dout, len);
+    eem_wb_do(ed, &d);
     // Always set BLVD disconnect method to Voltage
-    if (d[2] != EEM_VOLTAGE_DM) {
-        d[2] = EEM_VOLTAGE_DM;
+    if (eem_bit(&d, 2) != EEM_VOLTAGE_DM) {
+        eem_bit_set(&d, 2, EEM_VOLTAGE_DM);
     } else {
         return;
     }
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_write(ed, NULL, 0, &d, do_count);
 }
 
 void
@@ -3138,30 +4541,28 @@ eem_set_loadD_dm(struct pwr *pwr, uint8_t idx)
     struct eem *e;
     struct eemdev *ed;
     struct loadD *ld;
-    size_t len;
     size_t do_count;
-    uint8_t *d, *dout;
+    const eem_bits_t *dout;
+    eem_bits_t d;
 
     if (!(e = pwr->internal) ||!(ld = IS_LLVD(idx - 1))
             || !(ed = eemdev_find(e, ssprintf("070%d", idx)))
             || !(dout = ed->data.do_value)
-            || !(do_count = device->do_count)
-            || (len = do_count * sizeof d[0]) > 4096
-            || !(d = alloca(len))) {
+            || !(do_count = device->do_count)) {
         return;
     }
-    memmove(d, dout, len);
+    eem_wb_do(ed, &d);
     switch (ld->dm) {
     case BatteryVoltage:
-        d[2] = EEM_VOLTAGE_DM;
+        eem_bit_set(&d, 2, EEM_VOLTAGE_DM);
         break;
     case Time:
-        d[2] = EEM_TIME_DM;
+        eem_bit_set(&d, 2, EEM_TIME_DM);
         break;
     default:
         return;
     }
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_write(ed, NULL, 0, &d, do_count);
 }
 
 void
@@ -3171,7 +4572,7 @@ eem_set_contactors(struct pwr *pwr, uint8_t set, uint8_t clr)
     struct eem *e;
     struct eemdev *ed;
     size_t do_count;
-    uint8_t *d;
+    eem_bits_t *d;
     if (!(e = pwr->internal)
 	|| !(ed = eemdev_find(e, CSU_ID))
 	|| !(do_count = device->do_count)
@@ -3179,19 +4580,19 @@ eem_set_contactors(struct pwr *pwr, uint8_t set, uint8_t clr)
 	return;
     }
     if (set & 1) {
-	d[8] = 1;
+	eem_bit_set(d, 8, 1);
     } else if (clr & 1) {
-	d[8] = 0;
+	eem_bit_set(d, 8, 0);
     }
     if (set & 2) {
-	d[10] = 1;
+	eem_bit_set(d, 10, 1);
     } else if (clr & 2) {
-	d[10] = 0;
+	eem_bit_set(d, 10, 0);
     }
     if (set & 4) {
-	d[12] = 1;
+	eem_bit_set(d, 12, 1);
     } else if (clr & 4) {
-	d[12] = 0;
+	eem_bit_set(d, 12, 0);
     }
     eem_write(ed, NULL, 0, d, do_count);
 }
@@ -3218,7 +4619,7 @@ eem_set_float_voltage(struct pwr *pwr, float value)
     || !(f = alloca(len))) {
     return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     f[0] = value;
     eem_write(ed, f, ao_count, NULL, 0);
 }
@@ -3229,20 +4630,18 @@ eem_set_eco_mode(struct pwr *pwr, bool eco_mode)
     const struct eem_device *device = &eem_blocks[EEM_RECTIFIER_GROUP];
     struct eem *e;
     struct eemdev *ed;
-    size_t len;
     size_t do_count;
-    uint8_t *d, *dout;
+    const eem_bits_t *dout;
+    eem_bits_t d;
     if (!(e = pwr->internal)
 	|| !(ed = eemdev_find(e, RECTIFIER_GROUP_ID))
 	|| !(dout = ed->data.do_value)
-	|| !(do_count = device->do_count)
-	|| (len = do_count * sizeof d[0]) > 4096
-	|| !(d = alloca(len))) {
+	|| !(do_count = device->do_count)) {
 	return;
     }
-    memmove(d, dout, len);
-    d[6] = eco_mode;
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_wb_do(ed, &d);
+    eem_bit_set(&d, 6, eco_mode);
+    eem_write(ed, NULL, 0, &d, do_count);
 }
 
 void
@@ -3251,20 +4650,18 @@ eem_rectifier_enable(struct pwr *pwr, struct pwr_in *in, bool enable)
     const struct eem_device *device = &eem_blocks[EEM_RECTIFIER];
     struct eem *e;
     struct eemdev *ed;
-    size_t len;
     size_t do_count;
-    uint8_t *d, *dout;
+    const eem_bits_t *dout;
+    eem_bits_t d;
     if (!(e = pwr->internal)
 	|| !(ed = eemdev_find(e, in->id))
 	|| !(dout = ed->data.do_value)
-	|| !(do_count = device->do_count)
-	|| (len = do_count * sizeof d[0]) > 4096
-	|| !(d = alloca(len))) {
+	|| !(do_count = device->do_count)) {
 	return;
     }
-    memmove(d, dout, len);
-    d[0] = !enable;
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_wb_do(ed, &d);
+    eem_bit_set(&d, 0, !enable);
+    eem_write(ed, NULL, 0, &d, do_count);
 }
 
 bool
@@ -3321,7 +4718,7 @@ eem_set_bat_cap (struct pwr *pwr, float f)
             || !(data = alloca(len))) {
         return;
     }
-    memmove(data, ao, len);
+    eem_wb_ao(ed, data, ao_count);
     if (!isnan(f)) {
         data[0] = Ah(f);
     }
@@ -3733,6 +5130,7 @@ eem_debug(struct pwr *pwr, bool debug)
     struct eem *e;
     if ((e = pwr->internal)) {
 	e->debug = debug;
+	eem_rtt_print(e);
     }
 }
 
@@ -3853,7 +5251,7 @@ eem_set_undervolt(struct pwr *pwr, port_t contactorId, float value)
             || isnan(value)) {
         return;
     }
-    memmove(f, ao, len);
+    eem_wb_ao(ed, f, ao_count);
     switch(contactorId) {
     case MAIN_LD_CONID:
         f[EEMIDX_UNDERVOLT1] = value;
@@ -4221,24 +5619,22 @@ eem_bat_test(struct pwr *pwr, bool active)
     const struct eem_device *device = &eem_blocks[EEM_BATTERY_GROUP];
     struct eem *e;
     struct eemdev *ed;
-    size_t len;
     size_t do_count;
-    uint8_t *d, *dout;
+    const eem_bits_t *dout;
+    eem_bits_t d;
 
     if (!(e = pwr->internal)
     || !(ed = eemdev_find(e, BATTERY_GROUP_ID))
     || !(dout = ed->data.do_value)
-    || !(do_count = device->do_count)
-    || (len = do_count * sizeof d[0]) > 4096
-    || !(d = alloca(len))) {
+    || !(do_count = device->do_count)) {
         return;
     }
-    memmove(d, dout, len);
-    d[BATT_TEST_START] = active;
-    d[BATT_TEST_STOP] = !active;
-    if (!!d[BATT_TEST_AUTO])
-        d[BATT_TEST_AUTO] = false;
-    eem_write(ed, NULL, 0, d, do_count);
+    eem_wb_do(ed, &d);
+    eem_bit_set(&d, BATT_TEST_START, active);
+    eem_bit_set(&d, BATT_TEST_STOP, !active);
+    if (!!eem_bit(&d, BATT_TEST_AUTO))
+        eem_bit_set(&d, BATT_TEST_AUTO, false);
+    eem_write(ed, NULL, 0, &d, do_count);
     if (active)
         pwr_mode_set(pwr, PWR_MODE_TEST);
 }
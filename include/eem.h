@@ -1,25 +1,40 @@
 #ifndef EEM_H
 #define EEM_H
 
+#include "eem_bits.h"
+#include "eem_index.h"
+#include "eem_parse.h"
+#include "eem_rx.h"
+
 #define SOCKADDR(p) ((struct sockaddr *)p)
-#define EEM_MTU 1536
 #define EEM_TIMEOUT 10
+#define EEM_RTO_INIT_MS 3000	/* Retransmit timeout before the first RTT sample */
+#define EEM_RTO_MIN_MS 300	/* Default floor of the retransmit timeout */
+#define EEM_RTO_MAX_MS (EEM_TIMEOUT * 1000)	/* Default ceiling */
+#define EEM_RTO_GRANULARITY_MS 50
+#define EEM_BACKOFF_BASE_MS 1000	/* Reconnect backoff after the first failure */
+#define EEM_BACKOFF_MAX_MS 60000	/* Reconnect backoff ceiling */
+#define EEM_CONNECT_RATE 20	/* Connect attempts per second, all sessions */
+#define EEM_CONNECT_BURST 40
 #define EEM_LOST_TIMEOUT 60
 #define EEM_READ_TIMEOUT 1
 #define EEM_SCAN_PERIOD 90
+#define EEM_RC_RESYNC 300	/* Seconds before an unchanged alarm list is read in full */
+#define EEM_INVENTORY_DIR "/var/cache/eem"	/* Inventory cache, one file per controller */
+#define EEM_INVENTORY_MAX 65536	/* Largest inventory cache file read */
 #define POLL_LEN 9
 #define REQUEST_LEN (EEM_MTU - 18)
+#define EEM_QUEUE_MAX 256	/* Requests queued per session before new ones are refused */
 #define IDLEN 5
+#define EEM_DIRTY_AI 0x1	/* Fields of an RB reply that changed since the last one */
+#define EEM_DIRTY_AO 0x2
+#define EEM_DIRTY_DI 0x4
+#define EEM_DIRTY_DO 0x8
+#define EEM_RB_VALUE_FIELDS 4	/* Analog in, analog out, digital in, digital out */
 #define NAMELEN 32
+#define EEM_POLL_CLASS UINT32_MAX	/* Device is read at the rate of its block type */
+#define EEM_POLL_SLOW_MAX 8	/* Devices with an interval read per sweep */
 #define MAX_SEND_COUNT 2
-#define SOH 1
-#define STX 2
-#define ETX 3
-#define EOT 4
-#define ENQ 5
-#define ACK 6
-#define NAK 0x15
-#define END '*'
 #define FAST_SELECT 'F'
 #define POLL 'P'
 #define CSU_ID              "0000"
@@ -106,17 +121,62 @@ typedef enum {
 struct eemdata {
     float *ai_value;
     float *ao_value;
-    uint8_t *di_value;
-    uint8_t *do_value;
+    eem_bits_t *di_value;
+    eem_bits_t *do_value;
+};
+
+/* Scheduling classes, most urgent first */
+typedef enum {
+    EEM_PRIO_CONTROL,		/* WB writes and operator commands */
+    EEM_PRIO_ALARM,		/* RC alarm pages */
+    EEM_PRIO_TELEMETRY,		/* RB block reads */
+    EEM_PRIO_INVENTORY,		/* RI, RN, RP, DL, DP and checkpoints */
+    EEM_PRIO_CLASSES
+} eem_prio_t;
+
+/* Commands timed apart, see eemr_cmd() */
+typedef enum {
+    EEM_CMD_RB,
+    EEM_CMD_RC,
+    EEM_CMD_RI,
+    EEM_CMD_RN,
+    EEM_CMD_RP,
+    EEM_CMD_DL,
+    EEM_CMD_DP,
+    EEM_CMD_WB,
+    EEM_CMD_OTHER,		/* Operator commands and checkpoints */
+    EEM_CMD_TYPES
+} eem_cmd_t;
+
+/* Round trip estimate of one command of a session, RFC 6298 style */
+struct eem_rtt {
+    uint32_t srtt;		/* Smoothed select to response time, ms */
+    uint32_t rttvar;		/* Round trip time variation, ms */
+    uint32_t rto;		/* Retransmit timeout, ms, 0 until sampled */
+    uint32_t samples;
+    uint32_t timeouts;
+};
+
+/* Callback of a request that joined an identical one, see eemr_new() */
+struct eemr_waiter {
+    struct eemr_waiter *next;
+    eem_callback_t *callback;
+    void *arg;
 };
 
 struct eemr {
     struct list_head list;
+    struct eem *eem;
+    eem_prio_t prio;
+    eem_cmd_t cmd;
+    time_t deadline;		/* time_monotonic() by which it should be sent */
+    uint64_t key;		/* Read command packed, 0 when it cannot be shared */
     size_t request_len;
-    char request[REQUEST_LEN];
     int send_count;
     eem_callback_t *user_callback;
     void *user_data;
+    struct eemr_waiter *waiters;	/* Also handed the response, in order */
+    char request[];		/* request_len bytes, NUL terminated */
 };
 
 #ifdef EEMPHY
@@ -139,9 +199,12 @@ struct eemphr {
 #endif
 
 struct eem {
-    struct list_head device;
+    struct list_head device;	/* In read sweep order */
     struct list_head physical;
+    struct eem_index device_index;	/* struct eemdev by packed ID */
+    struct eem_index physical_index;	/* struct eemphy by packed ID */
     struct list_head queue;
+    size_t queue_len;
     struct pwr *pwr;
     ip_ssaddr_t dest;
     MO_instance *ld[2];
@@ -150,6 +213,8 @@ struct eem {
     struct event *scan_event;
     struct event *event;
     struct event *snmp_event;
+    struct event *wb_event;	/* Flushes merged block writes, see eem_write() */
+    struct event *sweep_event;	/* Restarts a sweep a full queue refused */
     char name[NAMELEN];
     char cc_id[2];
     eem_state_t state;
@@ -159,6 +224,22 @@ struct eem {
     bool debug;
     uint8_t tmout_cnt;
     bool rb_rq_loop;        /* RB request loop active */
+    uint8_t sweep_slow;		/* Devices with an interval read this sweep */
+    uint64_t ri_hash;		/* Of the last RI reply taken in, 0 for none */
+    bool alarm_dirty;		/* A status register changed since the last full RC read */
+    bool rc_valid;		/* rc_pages hold the pages of a full RC read */
+    uint64_t rc_first_hash;	/* Of the first page of that read */
+    time_t rc_full_time;	/* time_monotonic() when it was done */
+    char *rc_pages;		/* Its pages after the first, each NUL terminated */
+    size_t rc_pages_len;
+    size_t rc_pages_size;
+    uint32_t ri_gen;		/* RI replies taken in */
+    uint64_t inventory_hash;	/* Of the inventory cache last read or written */
+    bool inventory_loading;	/* Building devices from the cache, do not save */
+    uint64_t select_ms;		/* When the head of the queue was last selected */
+    uint8_t reconnect_attempts;	/* Failed connects since the last success */
+    struct eem_rtt rtt[EEM_CMD_TYPES];
+    struct eem_rx rx;
     struct snmpget_multi *sm;
     ncu_snmp_state_t snmp_status;
 };
@@ -243,6 +324,11 @@ extern const char *eem_check_BLVD (struct pwr *, MO_instance *);
 extern const char *eem_check_LVD (struct pwr *, MO_instance *);
 extern void eem_loadD_get_device_config(struct pwr *, struct loadD *);
 extern void eem_reconnect(struct eem *);
+extern void eem_set_rto_limits(uint32_t, uint32_t);
+extern const struct eem_rtt *eem_rtt_stats(struct pwr *, eem_cmd_t);
+extern void eem_set_poll_interval(eemid_t, uint32_t);
+extern void eem_set_device_poll_interval(struct pwr *, const char *, uint32_t);
+extern void eem_set_rc_shortcut(bool);
 void eem_thrh_value(struct pwr *, struct thrh *);
 #ifdef MEMDEBUG
 extern void eem_cleanup(void);
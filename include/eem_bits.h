@@ -0,0 +1,104 @@
+#ifndef EEM_BITS_H
+#define EEM_BITS_H
+
+/*
+ * Digital inputs and outputs of an EEM block, packed 64 to a word. Bit i
+ * is the i-th DI/DO of the block, i.e. what used to be di_value[i].
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define EEM_BITS_MAX 128	/* Covers EEM_MAX_DI and EEM_MAX_DO */
+#define EEM_BITS_WORDS (EEM_BITS_MAX / 64)
+
+typedef struct {
+    uint64_t w[EEM_BITS_WORDS];
+} eem_bits_t;
+
+static inline bool
+eem_bit(const eem_bits_t *b, size_t i)
+{
+    return b->w[i >> 6] >> (i & 63) & 1;
+}
+
+static inline void
+eem_bit_set(eem_bits_t *b, size_t i, bool v)
+{
+    uint64_t m = (uint64_t)1 << (i & 63);
+    b->w[i >> 6] = v ? b->w[i >> 6] | m : b->w[i >> 6] & ~m;
+}
+
+static inline void
+eem_bits_and(eem_bits_t *r, const eem_bits_t *a, const eem_bits_t *b)
+{
+    size_t i;
+    for (i = 0; i < EEM_BITS_WORDS; i++) {
+	r->w[i] = a->w[i] & b->w[i];
+    }
+}
+
+static inline void
+eem_bits_or(eem_bits_t *r, const eem_bits_t *a, const eem_bits_t *b)
+{
+    size_t i;
+    for (i = 0; i < EEM_BITS_WORDS; i++) {
+	r->w[i] = a->w[i] | b->w[i];
+    }
+}
+
+/**
+ * @brief Count the bits set in a
+ */
+static inline size_t
+eem_bits_count(const eem_bits_t *a)
+{
+    size_t i;
+    size_t n = 0;
+    for (i = 0; i < EEM_BITS_WORDS; i++) {
+	n += __builtin_popcountll(a->w[i]);
+    }
+    return n;
+}
+
+/**
+ * @brief Test whether a and mask have a bit in common
+ */
+static inline bool
+eem_bits_any(const eem_bits_t *a, const eem_bits_t *mask)
+{
+    size_t i;
+    for (i = 0; i < EEM_BITS_WORDS; i++) {
+	if (a->w[i] & mask->w[i]) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+
+/**
+ * @brief Render the first n flags as a digital field
+ * @param out	Room for (n + 3) / 4 characters, no NUL is added
+ * @return	Number of digits written; each holds 4 flags, the first one
+ *		in the most significant bit, and flags past n are 0
+ */
+static inline size_t
+eem_bits_put_hex(const eem_bits_t *b, size_t n, char *out)
+{
+    /* Digit of a nibble whose bit 0 is the first flag */
+    static const char rev[] = "084C2A6E195D3B7F";
+    size_t i;
+    size_t k = 0;
+    unsigned v;
+    for (i = 0; i < n; i += 4) {
+	v = b->w[i >> 6] >> (i & 63) & 0xF;
+	if (n - i < 4) {
+	    v &= (1u << (n - i)) - 1;
+	}
+	out[k++] = rev[v];
+    }
+    return k;
+}
+
+#endif
@@ -0,0 +1,1136 @@
+#ifndef EEM_BLOCKS_H
+#define EEM_BLOCKS_H
+
+/*
+ * Values of the EEM blocks in the order of their RB response: for each
+ * block the analog inputs (AI), analog outputs (AO), digital inputs (DI)
+ * and outputs (DO) it has, as X(index, name). eem_blocks[] (eem_parse.c)
+ * and eemBlockSchemas[] (EemSchema.h) take their names and counts from
+ * these lists, and the engine reads the values by the indexes below.
+ * The "Enable/Disable" flag after a digital value X is X_EN.
+ */
+
+#define EEM_INDEX(i, name) i,
+#define EEM_NAME(i, name) name,
+
+/* System */
+#define EEM_SYSTEM_AI(X) \
+    X(EEM_SYSTEM_AI_SYSTEM_VOLTAGE, "System Voltage") \
+    X(EEM_SYSTEM_AI_SYSTEM_LOAD, "System Load") \
+    X(EEM_SYSTEM_AI_SYSTEM_POWER, "System Power") \
+    X(EEM_SYSTEM_AI_TOTAL_SYSTEM_POWER_CONSUMPTION, "Total System Power Consumption") \
+    X(EEM_SYSTEM_AI_SYSTEM_POWER_PEAK_DURING_LAST_24_HOURS, "System Power Peak During Last 24 Hours") \
+    X(EEM_SYSTEM_AI_AVERAGE_SYSTEM_POWER_DURING_LAST_24_HOURS, "Average System Power During Last 24 Hours") \
+    X(EEM_SYSTEM_AI_AMBIENT_TEMPERATURE, "Ambient Temperature") \
+    X(EEM_SYSTEM_AI_OUTSIDE_TEMPERATURE, "Outside Temperature") \
+    X(EEM_SYSTEM_AI_TOTAL_SYSTEM_DISTRIBUTED_POWER, "Total System Distributed Power") \
+    X(EEM_SYSTEM_AI_POWER_EFFICIENCY, "Power Efficiency") \
+    X(EEM_SYSTEM_AI_IB2_1_TEMP_1, "IB2-1 Temp 1") \
+    X(EEM_SYSTEM_AI_IB2_1_TEMP_2, "IB2-1 Temp 2") \
+    X(EEM_SYSTEM_AI_EIB_1_TEMP_1, "EIB-1 Temp 1") \
+    X(EEM_SYSTEM_AI_EIB_1_TEMP_2, "EIB-1 Temp 2")
+
+#define EEM_SYSTEM_AO(X) \
+    X(EEM_SYSTEM_AO_SYSTEM_VOLTAGE_SET_POINT, "System Voltage Set Point") \
+    X(EEM_SYSTEM_AO_UNDER_VOLTAGE_1_LEVEL, "Under voltage 1 level") \
+    X(EEM_SYSTEM_AO_UNDER_VOLTAGE_1_HYST, "Under voltage 1 hyst (cease limit)") \
+    X(EEM_SYSTEM_AO_UNDER_VOLTAGE_2_LEVEL, "Under voltage 2 level") \
+    X(EEM_SYSTEM_AO_UNDER_VOLTAGE_2_HYST, "Under voltage 2 hyst (cease limit)") \
+    X(EEM_SYSTEM_AO_OVER_VOLTAGE_LEVEL, "Over voltage level") \
+    X(EEM_SYSTEM_AO_OVER_VOLTAGE_HYST, "Over voltage hyst (cease limit)") \
+    X(EEM_SYSTEM_AO_MAINS_FAULT_ALARM_DELAY, "Mains Fault Alarm Delay") \
+    X(EEM_SYSTEM_AO_RESERVED, "Reserved") \
+    X(EEM_SYSTEM_AO_HIGH_AMBIENT_TEMPERATURE_LIMIT, "High Ambient Temperature Limit") \
+    X(EEM_SYSTEM_AO_LOW_AMBIENT_TEMPERATURE_LIMIT, "Low Ambient Temperature Limit") \
+    X(EEM_SYSTEM_AO_GENERATOR_RUNTIME_AT_HIGH_TEMPERATURE_ALARM, "Generator runtime at high temperature alarm") \
+    X(EEM_SYSTEM_AO_HIGH_OUTSIDE_TEMPERATURE_LIMIT, "High outside temperature limit") \
+    X(EEM_SYSTEM_AO_LOW_OUTSIDE_TEMPERATURE_LIMIT, "Low outside temperature limit") \
+    X(EEM_SYSTEM_AO_HIGH_IB2_1_TEMPERATURE_LIMIT, "High IB2-1 temperature limit") \
+    X(EEM_SYSTEM_AO_LOW_IB2_1_TEMPERATURE_LIMIT, "Low IB2-1 temperature limit") \
+    X(EEM_SYSTEM_AO_HIGH_IB2_2_TEMPERATURE_LIMIT, "High IB2-2 temperature limit") \
+    X(EEM_SYSTEM_AO_LOW_IB2_2_TEMPERATURE_LIMIT, "Low IB2-2 temperature limit") \
+    X(EEM_SYSTEM_AO_HIGH_EIB_1_TEMPERATURE_LIMIT, "High EIB-1 temperature limit") \
+    X(EEM_SYSTEM_AO_LOW_EIB_1_TEMPERATURE_LIMIT, "Low EIB-1 temperature limit") \
+    X(EEM_SYSTEM_AO_HIGH_EIB_2_TEMPERATURE_LIMIT, "High EIB-2 temperature limit") \
+    X(EEM_SYSTEM_AO_LOW_EIB_2_TEMPERATURE_LIMIT, "Low EIB-2 temperature limit")
+
+#define EEM_SYSTEM_DI(X) \
+    X(EEM_SYSTEM_DI_OPTO_COMMUNICATION_FAILURE, "Opto Communication failure") \
+    X(EEM_SYSTEM_DI_OPTO_COMMUNICATION_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_MAINS_FAILURE, "Mains failure") \
+    X(EEM_SYSTEM_DI_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_UNDER_VOLTAGE_1, "Under voltage 1") \
+    X(EEM_SYSTEM_DI_UNDER_VOLTAGE_1_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_UNDER_VOLTAGE_2, "Under voltage 2") \
+    X(EEM_SYSTEM_DI_UNDER_VOLTAGE_2_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_OVER_VOLTAGE, "Over voltage") \
+    X(EEM_SYSTEM_DI_OVER_VOLTAGE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_HIGH_AMBIENT_TEMPERATURE, "High ambient temperature") \
+    X(EEM_SYSTEM_DI_HIGH_AMBIENT_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_REMOTE_SHUT_DOWN, "Remote shut down") \
+    X(EEM_SYSTEM_DI_REMOTE_SHUT_DOWN_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_1, "General input 1") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_1_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_2, "General input 2") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_2_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_3, "General input 3") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_3_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_4, "General input 4") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_4_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_5, "General input 5") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_5_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_6, "General input 6") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_6_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_7, "General input 7") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_7_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_8, "General input 8") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_8_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_RESERVED_ALARM_POSITION, "Reserved Alarm Position") \
+    X(EEM_SYSTEM_DI_RESERVED_ALARM_POSITION_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_10, "General input 10") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_10_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_11, "General input 11") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_11_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_12, "General input 12") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_12_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_13, "General input 13") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_13_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_14, "General input 14") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_14_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_15, "General input 15") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_15_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_16, "General input 16") \
+    X(EEM_SYSTEM_DI_GENERAL_INPUT_16_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SUPERVISION_UNIT_INTERNAL_FAULT, "Supervision Unit Internal Fault") \
+    X(EEM_SYSTEM_DI_SUPERVISION_UNIT_INTERNAL_FAULT_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SUPERVISION_UNIT_UNCALIBRATED, "Supervision Unit Uncalibrated") \
+    X(EEM_SYSTEM_DI_SUPERVISION_UNIT_UNCALIBRATED_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_AMBIENT_TEMPERATURE_SENSOR_FAULT, "Ambient Temperature Sensor Fault") \
+    X(EEM_SYSTEM_DI_AMBIENT_TEMPERATURE_SENSOR_FAULT_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_LOW_AMBIENT_TEMPERATURE, "Low Ambient Temperature") \
+    X(EEM_SYSTEM_DI_LOW_AMBIENT_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_OUTGOING_ALARMS_BLOCKED, "Outgoing Alarms Blocked") \
+    X(EEM_SYSTEM_DI_OUTGOING_ALARMS_BLOCKED_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SYSTEM_CONFIGURATION_FAULT, "System Configuration Fault") \
+    X(EEM_SYSTEM_DI_SYSTEM_CONFIGURATION_FAULT_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_CAN_COMMUNICATION_FAILURE, "CAN Communication Failure") \
+    X(EEM_SYSTEM_DI_CAN_COMMUNICATION_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_MULTIPLE_UNITS_LOST, "Multiple Units Lost") \
+    X(EEM_SYSTEM_DI_MULTIPLE_UNITS_LOST_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_LOAD_SHUNT_FAULT, "Load shunt fault") \
+    X(EEM_SYSTEM_DI_LOAD_SHUNT_FAULT_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_PRIO_2_LOAD_DISCONNECTED, "Prio 2 Load Disconnected") \
+    X(EEM_SYSTEM_DI_PRIO_2_LOAD_DISCONNECTED_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SYSTEM_MAINTENANCE_TIME_LIMIT_ALARM, "System Maintenance Time Limit Alarm") \
+    X(EEM_SYSTEM_DI_SYSTEM_MAINTENANCE_TIME_LIMIT_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_HIGH_LOAD, "High Load") \
+    X(EEM_SYSTEM_DI_HIGH_LOAD_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SMOKE_DETECTED, "Smoke detected") \
+    X(EEM_SYSTEM_DI_SMOKE_DETECTED_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_INTRUDER_ALARM, "Intruder alarm") \
+    X(EEM_SYSTEM_DI_INTRUDER_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_AC_MAINS_OK, "AC Mains OK") \
+    X(EEM_SYSTEM_DI_AC_MAINS_OK_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_CRITICAL_INVERTER_ALARM, "Critical Inverter alarm") \
+    X(EEM_SYSTEM_DI_CRITICAL_INVERTER_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_CRITICAL_DC_DC_CONVERTER_ALARM, "Critical DC/DC converter alarm") \
+    X(EEM_SYSTEM_DI_CRITICAL_DC_DC_CONVERTER_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_COOLING_ALARM, "Cooling alarm") \
+    X(EEM_SYSTEM_DI_COOLING_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_DIESEL_FAIL_ALARM, "Diesel fail alarm") \
+    X(EEM_SYSTEM_DI_DIESEL_FAIL_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_AVIATION_WARNING_LIGHTS_ALARM, "Aviation Warning Lights alarm") \
+    X(EEM_SYSTEM_DI_AVIATION_WARNING_LIGHTS_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_WARNING_DC_DC_CONVERTER_ALARM, "Warning DC/DC converter alarm") \
+    X(EEM_SYSTEM_DI_WARNING_DC_DC_CONVERTER_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_WARNING_INVERTER_ALARM, "Warning Inverter alarm") \
+    X(EEM_SYSTEM_DI_WARNING_INVERTER_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_OUTSIDE_HIGH_TEMPERATURE_ALARM, "Outside high temperature alarm") \
+    X(EEM_SYSTEM_DI_OUTSIDE_HIGH_TEMPERATURE_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_OUTSIDE_LOW_TEMPERATURE_ALARM, "Outside low temperature alarm") \
+    X(EEM_SYSTEM_DI_OUTSIDE_LOW_TEMPERATURE_ALARM_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_SPD_FAULT, "SPD Fault") \
+    X(EEM_SYSTEM_DI_SPD_FAULT_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DI_FAN_FAULT, "Fan Fault") \
+    X(EEM_SYSTEM_DI_FAN_FAULT_EN, "Enable/Disable")
+
+#define EEM_SYSTEM_DO(X) \
+    X(EEM_SYSTEM_DO_HYBRID_FUNCTION_ON_OFF, "Hybrid function on/off") \
+    X(EEM_SYSTEM_DO_HYBRID_FUNCTION_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_TIME_OR_CAPACITY_MODE_0_TIME_1_CAPACITY, "Time or Capacity mode (Hybrid) 0 = Time 1 = Capacity") \
+    X(EEM_SYSTEM_DO_TIME_OR_CAPACITY_MODE_0_TIME_1_CAPACITY_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_GENERATOR_IN_OPERATION_WITH_HIGH_TEMPERATURE, "Generator in operation with high temperature (0=DC cooling 1=AC cooling)") \
+    X(EEM_SYSTEM_DO_GENERATOR_IN_OPERATION_WITH_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_RESET_TOTAL_SYSTEM_DISTRIBUTED_POWER, "Reset Total System Distributed Power") \
+    X(EEM_SYSTEM_DO_RESET_TOTAL_SYSTEM_DISTRIBUTED_POWER_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_CONTACTOR_1_CONTROL, "Contactor 1 Control") \
+    X(EEM_SYSTEM_DO_CONTACTOR_1_CONTROL_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_CONTACTOR_2_CONTROL, "Contactor 2 Control") \
+    X(EEM_SYSTEM_DO_CONTACTOR_2_CONTROL_EN, "Enable/Disable") \
+    X(EEM_SYSTEM_DO_CONTACTOR_3_CONTROL, "Contactor 3 Control") \
+    X(EEM_SYSTEM_DO_CONTACTOR_3_CONTROL_EN, "Enable/Disable")
+
+/* Rectifier Group */
+#define EEM_RECTIFIER_GROUP_AI(X) \
+    X(EEM_RECTIFIER_GROUP_AI_VOLTAGE, "Voltage") \
+    X(EEM_RECTIFIER_GROUP_AI_CURRENT, "Current") \
+    X(EEM_RECTIFIER_GROUP_AI_USED_CAPACITY, "Used Capacity") \
+    X(EEM_RECTIFIER_GROUP_AI_MIN_USED_CAPACITY, "Min Used Capacity") \
+    X(EEM_RECTIFIER_GROUP_AI_MAX_USED_CAPACITY, "Max Used Capacity") \
+    X(EEM_RECTIFIER_GROUP_AI_NUMBER_OF_RECTIFIERS, "Number of rectifiers")
+
+#define EEM_RECTIFIER_GROUP_AO(X) \
+    X(EEM_RECTIFIER_GROUP_AO_WALK_IN_WITH_LOAD_TIME, "Walk-In with Load time") \
+    X(EEM_RECTIFIER_GROUP_AO_INPUT_CURRENT_LIMIT, "Input current limit") \
+    X(EEM_RECTIFIER_GROUP_AO_ECO_MODE_BEST_OPERATING_POINT, "ECO mode best operating point") \
+    X(EEM_RECTIFIER_GROUP_AO_ECO_MODE_LOAD_FLUCTUATION_RANGE, "ECO mode load fluctuation range") \
+    X(EEM_RECTIFIER_GROUP_AO_ECO_MODE_SWITCH_OFF_DELAY, "ECO mode switch off delay")
+
+#define EEM_RECTIFIER_GROUP_DI(X) \
+    X(EEM_RECTIFIER_GROUP_DI_DOUBLE_RECTIFIER_FAILURE, "Double rectifier failure (When more than one rectifier sends Rectifier Internal Fault)") \
+    X(EEM_RECTIFIER_GROUP_DI_DOUBLE_RECTIFIER_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DI_RECTIFIER_MAINS_FAULT, "Rectifier Mains Fault (When all rectifiers sends Mains fault)") \
+    X(EEM_RECTIFIER_GROUP_DI_RECTIFIER_MAINS_FAULT_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DI_MAINS_FAULT, "Mains Fault") \
+    X(EEM_RECTIFIER_GROUP_DI_MAINS_FAULT_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DI_RECTIFIER_LOST, "Rectifier Lost") \
+    X(EEM_RECTIFIER_GROUP_DI_RECTIFIER_LOST_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DI_ECO_MODE_ACTIVATED, "ECO mode activated") \
+    X(EEM_RECTIFIER_GROUP_DI_ECO_MODE_ACTIVATED_EN, "Enable/Disable")
+
+#define EEM_RECTIFIER_GROUP_DO(X) \
+    X(EEM_RECTIFIER_GROUP_DO_RESET_RECTIFER_LOST, "Reset Rectifer Lost") \
+    X(EEM_RECTIFIER_GROUP_DO_RESET_RECTIFER_LOST_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DO_WALK_IN_FEATURE_ON_OFF, "Walk-in feature on/off") \
+    X(EEM_RECTIFIER_GROUP_DO_WALK_IN_FEATURE_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DO_RESET_COMMUNICATION_FAILURE, "Reset Communication Failure") \
+    X(EEM_RECTIFIER_GROUP_DO_RESET_COMMUNICATION_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_GROUP_DO_ECO_MODE_ON_OFF, "ECO Mode on/off") \
+    X(EEM_RECTIFIER_GROUP_DO_ECO_MODE_ON_OFF_EN, "Enable/Disable")
+
+/* Rectifier */
+#define EEM_RECTIFIER_AI(X) \
+    X(EEM_RECTIFIER_AI_VOLTAGE, "Voltage") \
+    X(EEM_RECTIFIER_AI_CURRENT, "Current") \
+    X(EEM_RECTIFIER_AI_TEMPERATURE, "Temperature") \
+    X(EEM_RECTIFIER_AI_USED_CAPACITY, "Used Capacity") \
+    X(EEM_RECTIFIER_AI_INPUT_AC_VOLTAGE, "Input AC voltage") \
+    X(EEM_RECTIFIER_AI_TOTAL_RUNNING_TIME, "Total running time")
+
+#define EEM_RECTIFIER_AO(X) \
+    X(EEM_RECTIFIER_AO_VOLTAGE_SETPOINT, "Voltage setpoint") \
+    X(EEM_RECTIFIER_AO_OVER_VOLTAGE_ALARM_LEVEL, "Over voltage alarm level") \
+    X(EEM_RECTIFIER_AO_HIGH_TEMPERATURE_ALARM_LEVEL, "High temperature alarm level")
+
+#define EEM_RECTIFIER_DI(X) \
+    X(EEM_RECTIFIER_DI_RECTIFIER_ON_OFF, "Rectifier on/off") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_FAILURE, "Rectifier failure") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_MAINS_FAILURE, "Mains Failure") \
+    X(EEM_RECTIFIER_DI_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_OVER_VOLTAGE, "Over voltage") \
+    X(EEM_RECTIFIER_DI_OVER_VOLTAGE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_HIGH_TEMPERATURE, "High temperature") \
+    X(EEM_RECTIFIER_DI_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_CURRENT_LIMIT, "Rectifier Current Limit") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_CURRENT_LIMIT_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_AC_FAULT, "Rectifier AC Fault") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_AC_FAULT_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_COMMUNICATION_FAIL, "Rectifier Communication Fail") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_COMMUNICATION_FAIL_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_FAILURE_2, "Rectifier Failure") \
+    X(EEM_RECTIFIER_DI_RECTIFIER_FAILURE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_POWER_LIMIT, "Power Limit") \
+    X(EEM_RECTIFIER_DI_POWER_LIMIT_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DI_FAN_FAILURE, "Fan Failure") \
+    X(EEM_RECTIFIER_DI_FAN_FAILURE_EN, "Enable/Disable")
+
+#define EEM_RECTIFIER_DO(X) \
+    X(EEM_RECTIFIER_DO_RECTIFIER_REMOTE_ON_OFF, "Rectifier remote on/off") \
+    X(EEM_RECTIFIER_DO_RECTIFIER_REMOTE_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_DO_REMOTE_RESET, "Remote reset (alarm reset)") \
+    X(EEM_RECTIFIER_DO_REMOTE_RESET_EN, "Enable/Disable")
+
+/* Battery Group */
+#define EEM_BATTERY_GROUP_AI(X) \
+    X(EEM_BATTERY_GROUP_AI_VOLTAGE, "Voltage") \
+    X(EEM_BATTERY_GROUP_AI_CURRENT, "Current") \
+    X(EEM_BATTERY_GROUP_AI_TEMPERATURE, "Temperature")
+
+#define EEM_BATTERY_GROUP_AO(X) \
+    X(EEM_BATTERY_GROUP_AO_VERY_HIGH_BATTERY_TEMP_LIMIT, "Very High Battery Temp Limit") \
+    X(EEM_BATTERY_GROUP_AO_VERY_HIGH_BATTERY_TEMP_LIMIT_HYST, "Very High Battery Temp Limit Hyst") \
+    X(EEM_BATTERY_GROUP_AO_HIGH_BATTERY_TEMP_LIMIT, "High Battery Temp Limit") \
+    X(EEM_BATTERY_GROUP_AO_HIGH_BATTERY_TEMP_LIMIT_HYST, "High Battery Temp Limit Hyst") \
+    X(EEM_BATTERY_GROUP_AO_LOW_BATTERY_TEMP_LIMIT, "Low Battery Temp Limit") \
+    X(EEM_BATTERY_GROUP_AO_LOW_BATTERY_TEMP_LIMIT_HYST, "Low Battery Temp Limit Hyst") \
+    X(EEM_BATTERY_GROUP_AO_VERY_HIGH_BATTERY_TEMP_LIMIT_OUPUT_VOLT, "Very High Battery Temp Limit Ouput volt") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_CURRENT_LIMIT, "Battery Current Limit") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_BOOST_CHARGE_VOLTAGE, "Battery Boost Charge Voltage") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_BOOST_CHARGE_FACTOR, "Battery Boost Charge Factor") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED_2, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_MANUAL_CHARGE_TIME, "Manual Charge Time") \
+    X(EEM_BATTERY_GROUP_AO_CYCLIC_CHARGE_TIME, "Cyclic Charge Time") \
+    X(EEM_BATTERY_GROUP_AO_CYCLIC_CHARGE_INTERVAL, "Cyclic Charge Interval") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED_3, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_VOLTAGE_LEVEL, "Battery Test Voltage Level") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_END_VOLTAGE, "Battery Test End Voltage") \
+    X(EEM_BATTERY_GROUP_AO_NOMINAL_BATTERY_CAPACITY, "Nominal Battery Capacity") \
+    X(EEM_BATTERY_GROUP_AO_USED_CAPACITY_LIMIT, "Used Capacity Limit") \
+    X(EEM_BATTERY_GROUP_AO_NUMBER_OF_SCHEDULE_TEST_PER_YEAR, "Number of Schedule Test per year") \
+    X(EEM_BATTERY_GROUP_AO_SCHEDULED_TEST_START_TIME, "Scheduled Test Start Time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_TIME, "Battery Test Time") \
+    X(EEM_BATTERY_GROUP_AO_NOMINAL_BATTERY_TEMPERATURE, "Nominal Battery Temperature") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED_4, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED_5, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_CELL_FACTOR, "Battery Cell Factor") \
+    X(EEM_BATTERY_GROUP_AO_NUMBER_OF_CELLS, "Number of Cells") \
+    X(EEM_BATTERY_GROUP_AO_RESERVED_6, "Reserved") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_1_TIME, "Battery test 1 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_2_TIME, "Battery test 2 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_3_TIME, "Battery test 3 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_4_TIME, "Battery test 4 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_5_TIME, "Battery test 5 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_6_TIME, "Battery test 6 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_7_TIME, "Battery test 7 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_8_TIME, "Battery test 8 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_9_TIME, "Battery test 9 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_10_TIME, "Battery test 10 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_11_TIME, "Battery test 11 time") \
+    X(EEM_BATTERY_GROUP_AO_BATTERY_TEST_12_TIME, "Battery test 12 time") \
+    X(EEM_BATTERY_GROUP_AO_EQUALIZING_CHARGE_DURATION, "Equalizing Charge Duration") \
+    X(EEM_BATTERY_GROUP_AO_EQULIZING_CHARGE_EVERY, "Equlizing charge every") \
+    X(EEM_BATTERY_GROUP_AO_CYCLIC_EQUALIZING_CHARGES_START_TIME, "Cyclic / Equalizing Charges start time") \
+    X(EEM_BATTERY_GROUP_AO_STABLE_BATTERY_CHARGE_DELAY, "Stable Battery Charge Delay") \
+    X(EEM_BATTERY_GROUP_AO_BOOST_CHARGE_CURRENT_TAIL, "Boost charge current tail") \
+    X(EEM_BATTERY_GROUP_AO_CYCLIC_DISCHARGE_TIME, "Cyclic Discharge time") \
+    X(EEM_BATTERY_GROUP_AO_DISCHARGE_START_HOUR, "Discharge Start Hour") \
+    X(EEM_BATTERY_GROUP_AO_CAPACITY_COEFFICIENT, "Capacity coefficient (Hybrid)") \
+    X(EEM_BATTERY_GROUP_AO_DEEP_OF_DISCHARGE_LOW_CAPACITY_LEVEL, "Deep Of Discharge/Low capacity level (Hybrid)") \
+    X(EEM_BATTERY_GROUP_AO_SM_BRC_RESISTANCE_TEST_INTERVAL, "SM-BRC Resistance Test Interval")
+
+#define EEM_BATTERY_GROUP_DI(X) \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_TEST_RUNNING, "Battery Test Running") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_TEST_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_TEST_FAILURE, "Battery test failure") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_TEST_FAILURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_BOOST_CHARGE, "Battery Boost Charge") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_BOOST_CHARGE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_BAD_BATTERY, "Bad battery") \
+    X(EEM_BATTERY_GROUP_DI_BAD_BATTERY_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_TEST_RUNNING, "Manual Battery Test Running") \
+    X(EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_TEST_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_SCHEDULE_BATTERY_TEST_RUNNING, "Schedule Battery Test Running") \
+    X(EEM_BATTERY_GROUP_DI_SCHEDULE_BATTERY_TEST_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_TEST_RUNNING, "Automatic Battery Test running") \
+    X(EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_TEST_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_BOOST_CHARGE, "Manual Battery Boost Charge") \
+    X(EEM_BATTERY_GROUP_DI_MANUAL_BATTERY_BOOST_CHARGE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_CYCLIC_BATTERY_BOOST_CHARGE_RUNNING, "Cyclic Battery Boost Charge running") \
+    X(EEM_BATTERY_GROUP_DI_CYCLIC_BATTERY_BOOST_CHARGE_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_BOOST_CHARGE_RUNNING, "Automatic Battery Boost Charge running") \
+    X(EEM_BATTERY_GROUP_DI_AUTOMATIC_BATTERY_BOOST_CHARGE_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_CURRENT_LIMITATION_RUNNING, "Battery Current Limitation running") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_CURRENT_LIMITATION_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_TEMPERATURE_SENSOR_FAILURE, "Temperature sensor failure") \
+    X(EEM_BATTERY_GROUP_DI_TEMPERATURE_SENSOR_FAILURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_TEMPERATURE, "High Temperature") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_VERY_HIGH_TEMPERATURE, "Very High Temperature") \
+    X(EEM_BATTERY_GROUP_DI_VERY_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_LOW_TEMPERATURE, "Low Temperature") \
+    X(EEM_BATTERY_GROUP_DI_LOW_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_SHUNT_FAULT, "Battery shunt fault") \
+    X(EEM_BATTERY_GROUP_DI_BATTERY_SHUNT_FAULT_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_BATTERY_CURRENT, "High Battery Current") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_BATTERY_CURRENT_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_EQUALIZING_BATTERY_BOOST_CHARGE_RUNNING, "Equalizing Battery Boost Charge running") \
+    X(EEM_BATTERY_GROUP_DI_EQUALIZING_BATTERY_BOOST_CHARGE_RUNNING_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_LOAD_ALARM, "High load alarm") \
+    X(EEM_BATTERY_GROUP_DI_HIGH_LOAD_ALARM_EN, "Enable/Disable")
+
+#define EEM_BATTERY_GROUP_DO(X) \
+    X(EEM_BATTERY_GROUP_DO_RESET_BAD_BATTERY_ALARM, "Reset bad battery alarm") \
+    X(EEM_BATTERY_GROUP_DO_RESET_BAD_BATTERY_ALARM_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_BOOST_CHARGE_FUNCTION_ON_OFF, "Battery Boost Charge Function On/Off (0: On (default) 1: Off)") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_BOOST_CHARGE_FUNCTION_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_START_BATTERY_BOOST_CHARGE, "Start Battery Boost Charge") \
+    X(EEM_BATTERY_GROUP_DO_START_BATTERY_BOOST_CHARGE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_STOP_BATTERY_BOOST_CHARGE, "Stop Battery Boost Charge") \
+    X(EEM_BATTERY_GROUP_DO_STOP_BATTERY_BOOST_CHARGE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_TEST_FUNCTION_ON_OFF, "Battery Test Function On/Off (0: On (default) 1: Off)") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_TEST_FUNCTION_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_START_BATTERY_TEST, "Start Battery Test (Manual)") \
+    X(EEM_BATTERY_GROUP_DO_START_BATTERY_TEST_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_STOP_BATTERY_TEST, "Stop Battery Test (Manual and Cyclic)") \
+    X(EEM_BATTERY_GROUP_DO_STOP_BATTERY_TEST_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_TEMPERATURE_VOLTAGE_CONTROL_ON_OFF, "Battery Temperature Voltage Control On/Off") \
+    X(EEM_BATTERY_GROUP_DO_BATTERY_TEMPERATURE_VOLTAGE_CONTROL_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_AUTOMATIC_BATTERY_TEST_FUNCTION_ON_OFF, "Automatic Battery Test Function On/Off") \
+    X(EEM_BATTERY_GROUP_DO_AUTOMATIC_BATTERY_TEST_FUNCTION_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_START_SM_BRC_RESISTANCE_TEST, "Start SM-BRC Resistance Test") \
+    X(EEM_BATTERY_GROUP_DO_START_SM_BRC_RESISTANCE_TEST_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_STOP_SM_BRC_RESISTANCE_TEST, "Stop SM-BRC Resistance Test") \
+    X(EEM_BATTERY_GROUP_DO_STOP_SM_BRC_RESISTANCE_TEST_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_RESET_BATTERY_CAPACITY, "Reset Battery Capacity") \
+    X(EEM_BATTERY_GROUP_DO_RESET_BATTERY_CAPACITY_EN, "Enable/Disable") \
+    X(EEM_BATTERY_GROUP_DO_RESET_BATTERY_TEST_FAILURE, "Reset Battery Test Failure") \
+    X(EEM_BATTERY_GROUP_DO_RESET_BATTERY_TEST_FAILURE_EN, "Enable/Disable")
+
+/* Battery Unit */
+#define EEM_BATTERY_UNIT_AI(X) \
+    X(EEM_BATTERY_UNIT_AI_VOLTAGE, "Voltage") \
+    X(EEM_BATTERY_UNIT_AI_BATTERY_CURRENT, "Battery current") \
+    X(EEM_BATTERY_UNIT_AI_TEMPERATURE, "Temperature") \
+    X(EEM_BATTERY_UNIT_AI_BATTERY_CAPACITY, "Battery capacity")
+
+#define EEM_BATTERY_UNIT_AO(X) \
+    X(EEM_BATTERY_UNIT_AO_NOMINAL_BATTERY_CAPACITY, "Nominal Battery Capacity")
+
+#define EEM_BATTERY_UNIT_DI(X) \
+    X(EEM_BATTERY_UNIT_DI_TEMPERATURE_SENSOR_FAULT, "Temperature Sensor Fault") \
+    X(EEM_BATTERY_UNIT_DI_TEMPERATURE_SENSOR_FAULT_EN, "Enable/Disable") \
+    X(EEM_BATTERY_UNIT_DI_HIGH_TEMPERATURE, "High Temperature") \
+    X(EEM_BATTERY_UNIT_DI_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_UNIT_DI_VERY_HIGH_TEMPERATURE, "Very High Temperature") \
+    X(EEM_BATTERY_UNIT_DI_VERY_HIGH_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_BATTERY_UNIT_DI_LOW_TEMPERATURE, "Low Temperature") \
+    X(EEM_BATTERY_UNIT_DI_LOW_TEMPERATURE_EN, "Enable/Disable")
+
+/* DC Distribution Group */
+#define EEM_DC_DISTRIBUTION_GROUP_AI(X) \
+    X(EEM_DC_DISTRIBUTION_GROUP_AI_VOLTAGE, "Voltage") \
+    X(EEM_DC_DISTRIBUTION_GROUP_AI_CURRENT, "Current")
+
+/* EIB Distribution Unit */
+#define EEM_EIB_DISTRIBUTION_UNIT_AI(X) \
+    X(EEM_EIB_DISTRIBUTION_UNIT_AI_CURRENT_1, "Current 1") \
+    X(EEM_EIB_DISTRIBUTION_UNIT_AI_CURRENT_2, "Current 2") \
+    X(EEM_EIB_DISTRIBUTION_UNIT_AI_UNUSED, "--") \
+    X(EEM_EIB_DISTRIBUTION_UNIT_AI_CURRENT_3, "Current 3")
+
+/* DC Distribution Fuse Unit */
+#define EEM_DC_DISTRIBUTION_FUSE_UNIT_AI(X) \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_VOLTAGE, "Voltage") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_1, "Current 1") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_2, "Current 2") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_3, "Current 3") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_4, "Current 4") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_5, "Current 5") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_6, "Current 6") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_7, "Current 7") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_8, "Current 8") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_9, "Current 9") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_10, "Current 10") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_11, "Current 11") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_12, "Current 12") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_13, "Current 13") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_14, "Current 14") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_15, "Current 15") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_16, "Current 16") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_17, "Current 17") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_18, "Current 18") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_19, "Current 19") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_20, "Current 20") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_21, "Current 21") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_22, "Current 22") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_23, "Current 23") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_24, "Current 24") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_CURRENT_25, "Current 25") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_DISTRIBUTED_POWER_1, "Distributed Power 1") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_DISTRIBUTED_POWER_2, "Distributed Power 2") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_DISTRIBUTED_POWER_3, "Distributed Power 3") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_DISTRIBUTED_POWER_4, "Distributed Power 4")
+
+#define EEM_DC_DISTRIBUTION_FUSE_UNIT_DI(X) \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_1, "Fuse 1") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_1_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_2, "Fuse 2") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_2_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_3, "Fuse 3") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_3_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_4, "Fuse 4") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_4_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_5, "Fuse 5") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_5_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_6, "Fuse 6") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_6_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_7, "Fuse 7") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_7_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_8, "Fuse 8") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_8_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_9, "Fuse 9") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_9_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_10, "Fuse 10") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_10_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_11, "Fuse 11") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_11_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_12, "Fuse 12") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_12_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_13, "Fuse 13") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_13_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_14, "Fuse 14") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_14_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_15, "Fuse 15") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_15_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_16, "Fuse 16") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_16_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_17, "Fuse 17") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_17_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_18, "Fuse 18") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_18_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_19, "Fuse 19") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_19_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_20, "Fuse 20") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_20_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_21, "Fuse 21") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_21_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_22, "Fuse 22") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_22_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_23, "Fuse 23") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_23_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_24, "Fuse 24") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_24_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_25, "Fuse 25") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_FUSE_25_EN, "Enable/Disable")
+
+#define EEM_DC_DISTRIBUTION_FUSE_UNIT_DO(X) \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_1, "Reset Distributed Power 1") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_1_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_2, "Reset Distributed Power 2") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_2_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_3, "Reset Distributed Power 3") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_3_EN, "Enable/Disable") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_4, "Reset Distributed Power 4") \
+    X(EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_RESET_DISTRIBUTED_POWER_4_EN, "Enable/Disable")
+
+/* Battery Fuse Group */
+#define EEM_BATTERY_FUSE_GROUP_AI(X) \
+    X(EEM_BATTERY_FUSE_GROUP_AI_VOLTAGE, "Voltage") \
+    X(EEM_BATTERY_FUSE_GROUP_AI_CURRENT, "Current")
+
+/* Battery Fuse Unit */
+#define EEM_BATTERY_FUSE_UNIT_AI(X) \
+    X(EEM_BATTERY_FUSE_UNIT_AI_VOLTAGE_1, "Voltage 1") \
+    X(EEM_BATTERY_FUSE_UNIT_AI_CURRENT_1, "Current 1") \
+    X(EEM_BATTERY_FUSE_UNIT_AI_VOLTAGE_2, "Voltage 2") \
+    X(EEM_BATTERY_FUSE_UNIT_AI_CURRENT_2, "Current 2")
+
+#define EEM_BATTERY_FUSE_UNIT_DI(X) \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_1, "Fuse Failure 1") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_1_EN, "Enable/Disable") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_2, "Fuse Failure 2") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_2_EN, "Enable/Disable") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_3, "Fuse Failure 3") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_3_EN, "Enable/Disable") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_UNCALIBRATED, "Uncalibrated") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_UNCALIBRATED_EN, "Enable/Disable") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_4, "Fuse Failure 4") \
+    X(EEM_BATTERY_FUSE_UNIT_DI_FUSE_FAILURE_4_EN, "Enable/Disable")
+
+/* LVD Group */
+#define EEM_LVD_GROUP_AO(X) \
+    X(EEM_LVD_GROUP_AO_NON_PRIO_TRIP_VOLTAGE, "Non Prio Trip Voltage") \
+    X(EEM_LVD_GROUP_AO_NON_PRIO_TRIP_HYST, "Non Prio Trip Hyst") \
+    X(EEM_LVD_GROUP_AO_PRIO_TRIP_VOLTAGE, "Prio Trip Voltage") \
+    X(EEM_LVD_GROUP_AO_PRIO_TRIP_HYST, "Prio Trip Hyst") \
+    X(EEM_LVD_GROUP_AO_LOAD_DISCONNECT_MODE, "Load Disconnect Mode") \
+    X(EEM_LVD_GROUP_AO_NON_PRIO_TRIP_TIME, "Non Prio Trip time") \
+    X(EEM_LVD_GROUP_AO_PRIO_TRIP_TIME, "Prio Trip Time") \
+    X(EEM_LVD_GROUP_AO_RECONNECT_LEVEL, "Reconnect Level") \
+    X(EEM_LVD_GROUP_AO_HIGH_TEMP_DISCONNECT_LEVEL, "High Temp Disconnect Level") \
+    X(EEM_LVD_GROUP_AO_HIGH_TEMP_RECONNECT_LEVEL, "High Temp Reconnect Level")
+
+#define EEM_LVD_GROUP_DI(X) \
+    X(EEM_LVD_GROUP_DI_LOAD_DISCONNECT_ERROR, "Load Disconnect Error") \
+    X(EEM_LVD_GROUP_DI_LOAD_DISCONNECT_ERROR_EN, "Enable/Disable")
+
+#define EEM_LVD_GROUP_DO(X) \
+    X(EEM_LVD_GROUP_DO_LOAD_DISCONNECT_ON_OFF, "Load Disconnect On/Off") \
+    X(EEM_LVD_GROUP_DO_LOAD_DISCONNECT_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_LVD_GROUP_DO_NORMAL_CONTACTOR_ENABLE_DISABLE, "Normal Contactor enable/disable") \
+    X(EEM_LVD_GROUP_DO_NORMAL_CONTACTOR_ENABLE_DISABLE_EN, "Enable/Disable") \
+    X(EEM_LVD_GROUP_DO_PRIO_CONTACTOR_ENABLE_DISABLE, "Prio Contactor enable/disable") \
+    X(EEM_LVD_GROUP_DO_PRIO_CONTACTOR_ENABLE_DISABLE_EN, "Enable/Disable")
+
+/* LVD Unit */
+#define EEM_LVD_UNIT_AO(X) \
+    X(EEM_LVD_UNIT_AO_LVD_TIME, "LVD time") \
+    X(EEM_LVD_UNIT_AO_LVD_VOLTAGE, "LVD voltage") \
+    X(EEM_LVD_UNIT_AO_LVD_RECONNECT_DELAY, "LVD reconnect delay") \
+    X(EEM_LVD_UNIT_AO_LVD_RECONNECT_VOLTAGE, "LVD reconnect voltage")
+
+#define EEM_LVD_UNIT_DI(X) \
+    X(EEM_LVD_UNIT_DI_LVD_DISCONNECTED, "LVD Disconnected") \
+    X(EEM_LVD_UNIT_DI_LVD_DISCONNECTED_EN, "Enable/Disable")
+
+#define EEM_LVD_UNIT_DO(X) \
+    X(EEM_LVD_UNIT_DO_LVD_ENABLE, "LVD enable") \
+    X(EEM_LVD_UNIT_DO_LVD_ENABLE_EN, "Enable/Disable") \
+    X(EEM_LVD_UNIT_DO_LVD_MODE, "LVD mode(0:Voltage, 1:Time)") \
+    X(EEM_LVD_UNIT_DO_LVD_MODE_EN, "Enable/Disable") \
+    X(EEM_LVD_UNIT_DO_RESERVED, "Reserved") \
+    X(EEM_LVD_UNIT_DO_RESERVED_EN, "Enable/Disable") \
+    X(EEM_LVD_UNIT_DO_RESERVED_2, "Reserved") \
+    X(EEM_LVD_UNIT_DO_RESERVED_2_EN, "Enable/Disable") \
+    X(EEM_LVD_UNIT_DO_HTD_ENABLE, "HTD enable") \
+    X(EEM_LVD_UNIT_DO_HTD_ENABLE_EN, "Enable/Disable")
+
+/* AC Group */
+#define EEM_AC_GROUP_AI(X) \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_1_CURRENT, "Total Phase 1 Current") \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_2_CURRENT, "Total Phase 2 Current") \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_3_CURRENT, "Total Phase 3 Current") \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_1_POWER, "Total Phase 1 Power") \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_2_POWER, "Total Phase 2 Power") \
+    X(EEM_AC_GROUP_AI_TOTAL_PHASE_3_POWER, "Total Phase 3 Power")
+
+/* Rectifier AC */
+#define EEM_RECTIFIER_AC_AI(X) \
+    X(EEM_RECTIFIER_AC_AI_MAIN_VOLTAGE_PHASE_1_2, "Main Voltage, Phase 1-2") \
+    X(EEM_RECTIFIER_AC_AI_MAIN_VOLTAGE_PHASE_2_3, "Main Voltage, Phase 2-3") \
+    X(EEM_RECTIFIER_AC_AI_MAIN_VOLTAGE_PHASE_3_1, "Main Voltage, Phase 3-1") \
+    X(EEM_RECTIFIER_AC_AI_VOLTAGE_PHASE_1, "Voltage, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_VOLTAGE_PHASE_2, "Voltage, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_VOLTAGE_PHASE_3, "Voltage, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_CURRENT_PHASE_1, "Current, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_CURRENT_PHASE_2, "Current, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_CURRENT_PHASE_3, "Current, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_AMBIENT_TEMPERATURE, "Ambient Temperature") \
+    X(EEM_RECTIFIER_AC_AI_MAINS_FREQUENCY, "Mains Frequency") \
+    X(EEM_RECTIFIER_AC_AI_MAINS_FAILURE_COUNTER_PHASE_1, "Mains Failure Counter, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_MAINS_FAILURE_COUNTER_PHASE_2, "Mains Failure Counter, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_MAINS_FAILURE_COUNTER_PHASE_3, "Mains Failure Counter, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_FREQUENCY_FAILURE_COUNTER, "Frequency Failure Counter") \
+    X(EEM_RECTIFIER_AC_AI_APPARENT_POWER_PHASE_1, "Apparent Power, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_APPARENT_POWER_PHASE_2, "Apparent Power, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_APPARENT_POWER_PHASE_3, "Apparent Power, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_REAL_POWER_PHASE_1, "Real Power, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_REAL_POWER_PHASE_2, "Real Power, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_REAL_POWER_PHASE_3, "Real Power, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_REACTIVE_POWER_PHASE_1, "Reactive Power, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_REACTIVE_POWER_PHASE_2, "Reactive Power, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_REACTIVE_POWER_PHASE_3, "Reactive Power, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_POWER_FACTOR_PHASE_1, "Power Factor, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_POWER_FACTOR_PHASE_2, "Power Factor, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_POWER_FACTOR_PHASE_3, "Power Factor, Phase 3") \
+    X(EEM_RECTIFIER_AC_AI_ENERGY_CONSUMPTION_1, "Energy Consumption 1") \
+    X(EEM_RECTIFIER_AC_AI_ENERGY_CONSUMPTION_2, "Energy Consumption 2") \
+    X(EEM_RECTIFIER_AC_AI_THD_CURRENT_PHASE_1, "THD Current, Phase 1") \
+    X(EEM_RECTIFIER_AC_AI_THD_CURRENT_PHASE_2, "THD Current, Phase 2") \
+    X(EEM_RECTIFIER_AC_AI_THD_CURRENT_PHASE_3, "THD Current, Phase 3")
+
+#define EEM_RECTIFIER_AC_AO(X) \
+    X(EEM_RECTIFIER_AC_AO_NOMINAL_MAINS_VOLTAGE, "Nominal Mains Voltage") \
+    X(EEM_RECTIFIER_AC_AO_NOMINAL_PHASE_VOLTAGE, "Nominal Phase Voltage") \
+    X(EEM_RECTIFIER_AC_AO_NOMINAL_FREQUENCY, "Nominal Frequency") \
+    X(EEM_RECTIFIER_AC_AO_MAINS_FAILURE_ALARM_THRESHOLD_1, "Mains Failure Alarm Threshold 1") \
+    X(EEM_RECTIFIER_AC_AO_MAINS_FAILURE_ALARM_THRESHOLD_2, "Mains Failure Alarm Threshold 2") \
+    X(EEM_RECTIFIER_AC_AO_FREQUENCY_ALARM_THRESHOLD, "Frequency Alarm Threshold") \
+    X(EEM_RECTIFIER_AC_AO_CURRENT_FACTOR, "Current Factor") \
+    X(EEM_RECTIFIER_AC_AO_ALARM_DURATION, "Alarm Duration") \
+    X(EEM_RECTIFIER_AC_AO_CURRENT_ALARM_THRESHOLD, "Current Alarm Threshold") \
+    X(EEM_RECTIFIER_AC_AO_TEMPERATURE_ALARM_THRESHOLD_HIGH, "Temperature Alarm Threshold, High") \
+    X(EEM_RECTIFIER_AC_AO_TEMPERATURE_ALARM_THRESHOLD_LOW, "Temperature Alarm Threshold, Low")
+
+#define EEM_RECTIFIER_AC_DI(X) \
+    X(EEM_RECTIFIER_AC_DI_UNIT_UNCALIBRATED, "Unit Uncalibrated") \
+    X(EEM_RECTIFIER_AC_DI_UNIT_UNCALIBRATED_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SUPERVISION_FAIL, "Supervision Fail") \
+    X(EEM_RECTIFIER_AC_DI_SUPERVISION_FAIL_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1_2, "Over voltage, Phase 1-2") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1_2, "Severe Over voltage, Phase 1-2") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1_2, "Under voltage, Phase 1-2") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_2, "Severe Under voltage, Phase 1-2") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1_3, "Over voltage, Phase 1-3") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1_3, "Severe Over voltage, Phase 1-3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1_3, "Under voltage, Phase 1-3") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_3, "Severe Under voltage, Phase 1-3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_2_3, "Over voltage, Phase 2-3") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_2_3, "Severe Over voltage, Phase 2-3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_2_3, "Under voltage, Phase 2-3") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_3, "Severe Under voltage, Phase 2-3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1, "Over voltage, Phase 1") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1, "Severe Over voltage, Phase 1") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1, "Under voltage, Phase 1") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1, "Severe Under voltage, Phase 1") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_2, "Over voltage, Phase 2") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_2, "Severe Over voltage, Phase 2") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_2, "Under voltage, Phase 2") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_2, "Severe Under voltage, Phase 2") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_3, "Over voltage, Phase 3") \
+    X(EEM_RECTIFIER_AC_DI_OVER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_3, "Severe Over voltage, Phase 3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_OVER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_3, "Under voltage, Phase 3") \
+    X(EEM_RECTIFIER_AC_DI_UNDER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_3, "Severe Under voltage, Phase 3") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_UNDER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_MAINS_FAILURE, "Mains Failure") \
+    X(EEM_RECTIFIER_AC_DI_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_MAINS_FAILURE, "Severe Mains Failure") \
+    X(EEM_RECTIFIER_AC_DI_SEVERE_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_1, "High Current, Phase 1") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_2, "High Current, Phase 2") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_3, "High Current, Phase 3") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_CURRENT_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_FREQUENCY_FAILURE, "High Frequency Failure") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_FREQUENCY_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_TEMPERATURE_FAILURE, "High Temperature Failure") \
+    X(EEM_RECTIFIER_AC_DI_HIGH_TEMPERATURE_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_LOW_FREQUENCY_FAILURE, "Low Frequency Failure") \
+    X(EEM_RECTIFIER_AC_DI_LOW_FREQUENCY_FAILURE_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DI_LOW_TEMPERATURE_FAILURE, "Low Temperature Failure") \
+    X(EEM_RECTIFIER_AC_DI_LOW_TEMPERATURE_FAILURE_EN, "Enable/Disable")
+
+#define EEM_RECTIFIER_AC_DO(X) \
+    X(EEM_RECTIFIER_AC_DO_USE_DEFAULT_SETTINGS, "Use Default Settings") \
+    X(EEM_RECTIFIER_AC_DO_USE_DEFAULT_SETTINGS_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_1, "Reset Mains Fail Counter, Phase 1") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_2, "Reset Mains Fail Counter, Phase 2") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_3, "Reset Mains Fail Counter, Phase 3") \
+    X(EEM_RECTIFIER_AC_DO_RESET_MAINS_FAIL_COUNTER_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_RECTIFIER_AC_DO_RESET_FREQUENCY_FAIL_COUNTER, "Reset Frequency Fail Counter") \
+    X(EEM_RECTIFIER_AC_DO_RESET_FREQUENCY_FAIL_COUNTER_EN, "Enable/Disable")
+
+/* OB AC Unit */
+#define EEM_OB_AC_UNIT_AI(X) \
+    X(EEM_OB_AC_UNIT_AI_MAIN_VOLTAGE_PHASE_1_2, "Main Voltage, Phase 1-2") \
+    X(EEM_OB_AC_UNIT_AI_MAIN_VOLTAGE_PHASE_2_3, "Main Voltage, Phase 2-3") \
+    X(EEM_OB_AC_UNIT_AI_MAIN_VOLTAGE_PHASE_3_1, "Main Voltage, Phase 3-1") \
+    X(EEM_OB_AC_UNIT_AI_VOLTAGE_PHASE_1, "Voltage, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_VOLTAGE_PHASE_2, "Voltage, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_VOLTAGE_PHASE_3, "Voltage, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_CURRENT_PHASE_1, "Current, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_CURRENT_PHASE_2, "Current, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_CURRENT_PHASE_3, "Current, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_AMBIENT_TEMPERATURE, "Ambient Temperature") \
+    X(EEM_OB_AC_UNIT_AI_MAINS_FREQUENCY, "Mains Frequency") \
+    X(EEM_OB_AC_UNIT_AI_MAINS_FAILURE_COUNTER_PHASE_1, "Mains Failure Counter, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_MAINS_FAILURE_COUNTER_PHASE_2, "Mains Failure Counter, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_MAINS_FAILURE_COUNTER_PHASE_3, "Mains Failure Counter, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_FREQUENCY_FAILURE_COUNTER, "Frequency Failure Counter") \
+    X(EEM_OB_AC_UNIT_AI_APPARENT_POWER_PHASE_1, "Apparent Power, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_APPARENT_POWER_PHASE_2, "Apparent Power, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_APPARENT_POWER_PHASE_3, "Apparent Power, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_REAL_POWER_PHASE_1, "Real Power, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_REAL_POWER_PHASE_2, "Real Power, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_REAL_POWER_PHASE_3, "Real Power, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_REACTIVE_POWER_PHASE_1, "Reactive Power, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_REACTIVE_POWER_PHASE_2, "Reactive Power, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_REACTIVE_POWER_PHASE_3, "Reactive Power, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_POWER_FACTOR_PHASE_1, "Power Factor, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_POWER_FACTOR_PHASE_2, "Power Factor, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_POWER_FACTOR_PHASE_3, "Power Factor, Phase 3") \
+    X(EEM_OB_AC_UNIT_AI_ENERGY_CONSUMPTION_1, "Energy Consumption 1") \
+    X(EEM_OB_AC_UNIT_AI_ENERGY_CONSUMPTION_2, "Energy Consumption 2") \
+    X(EEM_OB_AC_UNIT_AI_THD_CURRENT_PHASE_1, "THD Current, Phase 1") \
+    X(EEM_OB_AC_UNIT_AI_THD_CURRENT_PHASE_2, "THD Current, Phase 2") \
+    X(EEM_OB_AC_UNIT_AI_THD_CURRENT_PHASE_3, "THD Current, Phase 3")
+
+#define EEM_OB_AC_UNIT_AO(X) \
+    X(EEM_OB_AC_UNIT_AO_NOMINAL_MAINS_VOLTAGE, "Nominal Mains Voltage") \
+    X(EEM_OB_AC_UNIT_AO_NOMINAL_PHASE_VOLTAGE, "Nominal Phase Voltage") \
+    X(EEM_OB_AC_UNIT_AO_NOMINAL_FREQUENCY, "Nominal Frequency") \
+    X(EEM_OB_AC_UNIT_AO_MAINS_FAILURE_ALARM_THRESHOLD_1, "Mains Failure Alarm Threshold 1") \
+    X(EEM_OB_AC_UNIT_AO_MAINS_FAILURE_ALARM_THRESHOLD_2, "Mains Failure Alarm Threshold 2") \
+    X(EEM_OB_AC_UNIT_AO_FREQUENCY_ALARM_THRESHOLD, "Frequency Alarm Threshold") \
+    X(EEM_OB_AC_UNIT_AO_CURRENT_FACTOR, "Current Factor") \
+    X(EEM_OB_AC_UNIT_AO_ALARM_DURATION, "Alarm Duration") \
+    X(EEM_OB_AC_UNIT_AO_CURRENT_ALARM_THRESHOLD, "Current Alarm Threshold") \
+    X(EEM_OB_AC_UNIT_AO_TEMPERATURE_ALARM_THRESHOLD_HIGH, "Temperature Alarm Threshold, High") \
+    X(EEM_OB_AC_UNIT_AO_TEMPERATURE_ALARM_THRESHOLD_LOW, "Temperature Alarm Threshold, Low")
+
+#define EEM_OB_AC_UNIT_DI(X) \
+    X(EEM_OB_AC_UNIT_DI_UNIT_UNCALIBRATED, "Unit Uncalibrated") \
+    X(EEM_OB_AC_UNIT_DI_UNIT_UNCALIBRATED_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SUPERVISION_FAIL, "Supervision Fail") \
+    X(EEM_OB_AC_UNIT_DI_SUPERVISION_FAIL_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1_2, "Over voltage, Phase 1-2") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1_2, "Severe Over voltage, Phase 1-2") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1_2, "Under voltage, Phase 1-2") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_2, "Severe Under voltage, Phase 1-2") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1_3, "Over voltage, Phase 1-3") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1_3, "Severe Over voltage, Phase 1-3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1_3, "Under voltage, Phase 1-3") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_3, "Severe Under voltage, Phase 1-3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_2_3, "Over voltage, Phase 2-3") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_2_3, "Severe Over voltage, Phase 2-3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_2_3, "Under voltage, Phase 2-3") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_3, "Severe Under voltage, Phase 2-3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1, "Over voltage, Phase 1") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1, "Severe Over voltage, Phase 1") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1, "Under voltage, Phase 1") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1, "Severe Under voltage, Phase 1") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_2, "Over voltage, Phase 2") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_2, "Severe Over voltage, Phase 2") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_2, "Under voltage, Phase 2") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_2, "Severe Under voltage, Phase 2") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_3, "Over voltage, Phase 3") \
+    X(EEM_OB_AC_UNIT_DI_OVER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_3, "Severe Over voltage, Phase 3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_OVER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_3, "Under voltage, Phase 3") \
+    X(EEM_OB_AC_UNIT_DI_UNDER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_3, "Severe Under voltage, Phase 3") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_UNDER_VOLTAGE_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_MAINS_FAILURE, "Mains Failure") \
+    X(EEM_OB_AC_UNIT_DI_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_MAINS_FAILURE, "Severe Mains Failure") \
+    X(EEM_OB_AC_UNIT_DI_SEVERE_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_1, "High Current, Phase 1") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_2, "High Current, Phase 2") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_3, "High Current, Phase 3") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_CURRENT_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_FREQUENCY_FAILURE, "High Frequency Failure") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_FREQUENCY_FAILURE_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_TEMPERATURE_FAILURE, "High Temperature Failure") \
+    X(EEM_OB_AC_UNIT_DI_HIGH_TEMPERATURE_FAILURE_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_LOW_FREQUENCY_FAILURE, "Low Frequency Failure") \
+    X(EEM_OB_AC_UNIT_DI_LOW_FREQUENCY_FAILURE_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DI_LOW_TEMPERATURE_FAILURE, "Low Temperature Failure") \
+    X(EEM_OB_AC_UNIT_DI_LOW_TEMPERATURE_FAILURE_EN, "Enable/Disable")
+
+#define EEM_OB_AC_UNIT_DO(X) \
+    X(EEM_OB_AC_UNIT_DO_USER_DEFAULT_SETTINGS, "User Default Settings") \
+    X(EEM_OB_AC_UNIT_DO_USER_DEFAULT_SETTINGS_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_1, "Reset Mains Fail Counter, Phase 1") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_1_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_2, "Reset Mains Fail Counter, Phase 2") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_2_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_3, "Reset Mains Fail Counter, Phase 3") \
+    X(EEM_OB_AC_UNIT_DO_RESET_MAINS_FAIL_COUNTER_PHASE_3_EN, "Enable/Disable") \
+    X(EEM_OB_AC_UNIT_DO_RESET_FREQUENCY_FAIL_COUNTER, "Reset Frequency Fail Counter") \
+    X(EEM_OB_AC_UNIT_DO_RESET_FREQUENCY_FAIL_COUNTER_EN, "Enable/Disable")
+
+/* Solar Converter Group */
+#define EEM_SOLAR_CONVERTER_GROUP_AI(X) \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_VOLTAGE, "Voltage") \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_CURRENT, "Current") \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_USED_CAPACITY, "Used Capacity") \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_MIN_USED_CAPACITY, "Min Used Capacity") \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_MAX_USED_CAPACITY, "Max Used Capacity") \
+    X(EEM_SOLAR_CONVERTER_GROUP_AI_NUMBER_OF_CONVERTERS, "Number of converters")
+
+#define EEM_SOLAR_CONVERTER_GROUP_DI(X) \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_DOUBLE_CONVERTER_FAILURE, "Double converter failure") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_DOUBLE_CONVERTER_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_RESERVED, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_RESERVED_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_CONVERTER_LOST, "Converter Lost") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_CONVERTER_LOST_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_CAPACITY_LIMITATION, "Capacity Limitation") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_CAPACITY_LIMITATION_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_UNBALANCED_CURRENT, "Unbalanced current") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_UNBALANCED_CURRENT_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_OVERVOLTAGE, "Overvoltage") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_OVERVOLTAGE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_LOCAL_COMMUNICATION_FAILURE, "Local communication failure") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DI_LOCAL_COMMUNICATION_FAILURE_EN, "Enable/Disable")
+
+#define EEM_SOLAR_CONVERTER_GROUP_DO(X) \
+    X(EEM_SOLAR_CONVERTER_GROUP_DO_RESET_CONVERTER_LOST, "Reset Converter Lost") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DO_RESET_CONVERTER_LOST_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DO_RESET_MODULES, "Reset modules") \
+    X(EEM_SOLAR_CONVERTER_GROUP_DO_RESET_MODULES_EN, "Enable/Disable")
+
+/* Solar Converter */
+#define EEM_SOLAR_CONVERTER_AI(X) \
+    X(EEM_SOLAR_CONVERTER_AI_VOLTAGE, "Voltage") \
+    X(EEM_SOLAR_CONVERTER_AI_CURRENT, "Current") \
+    X(EEM_SOLAR_CONVERTER_AI_RESERVED, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_AI_RESERVED_2, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_AI_RESERVED_3, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_AI_TOTAL_RUNNING_TIME, "Total running time") \
+    X(EEM_SOLAR_CONVERTER_AI_LIMITED_CURRENT, "Limited current") \
+    X(EEM_SOLAR_CONVERTER_AI_INPUT_VOLTAGE, "Input voltage") \
+    X(EEM_SOLAR_CONVERTER_AI_INPUT_CURRENT, "Input current") \
+    X(EEM_SOLAR_CONVERTER_AI_TEMPERATURE, "Temperature") \
+    X(EEM_SOLAR_CONVERTER_AI_OUTPUT_CAPACITY, "Output capacity")
+
+#define EEM_SOLAR_CONVERTER_DI(X) \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_ON_OFF, "Converter on/off") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_FAILURE, "Converter failure") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_MAINS_FAILURE, "Mains Failure") \
+    X(EEM_SOLAR_CONVERTER_DI_MAINS_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_OVER_VOLTAGE, "Over voltage") \
+    X(EEM_SOLAR_CONVERTER_DI_OVER_VOLTAGE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_CURRENT_LIMIT, "Converter Current Limit") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_CURRENT_LIMIT_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED_2, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED_2_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_COMMUNICATION_FAIL, "Converter Communication Fail") \
+    X(EEM_SOLAR_CONVERTER_DI_CONVERTER_COMMUNICATION_FAIL_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED_3, "Reserved") \
+    X(EEM_SOLAR_CONVERTER_DI_RESERVED_3_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_POWER_LIMIT, "Power Limit") \
+    X(EEM_SOLAR_CONVERTER_DI_POWER_LIMIT_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_FAN_FAILURE, "Fan Failure") \
+    X(EEM_SOLAR_CONVERTER_DI_FAN_FAILURE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_LIMITED_DUE_TO_HIGH_TEMP, "Limited due to high temp") \
+    X(EEM_SOLAR_CONVERTER_DI_LIMITED_DUE_TO_HIGH_TEMP_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_FANS_IN_FULL_SPEED, "Fans in full speed") \
+    X(EEM_SOLAR_CONVERTER_DI_FANS_IN_FULL_SPEED_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_WALK_IN, "WALK in") \
+    X(EEM_SOLAR_CONVERTER_DI_WALK_IN_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_EQUALIZED_CHARGING, "Equalized charging") \
+    X(EEM_SOLAR_CONVERTER_DI_EQUALIZED_CHARGING_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_TEST_IN_PROCESS, "Test in process") \
+    X(EEM_SOLAR_CONVERTER_DI_TEST_IN_PROCESS_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_OVER_TEMPERATURE, "Over temperature") \
+    X(EEM_SOLAR_CONVERTER_DI_OVER_TEMPERATURE_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DI_UNBALANCED_CURRENT, "Unbalanced current") \
+    X(EEM_SOLAR_CONVERTER_DI_UNBALANCED_CURRENT_EN, "Enable/Disable")
+
+#define EEM_SOLAR_CONVERTER_DO(X) \
+    X(EEM_SOLAR_CONVERTER_DO_CONVERTER_REMOTE_ON_OFF, "Converter remote on/off") \
+    X(EEM_SOLAR_CONVERTER_DO_CONVERTER_REMOTE_ON_OFF_EN, "Enable/Disable") \
+    X(EEM_SOLAR_CONVERTER_DO_REMOTE_RESET, "Remote reset (alarm reset)") \
+    X(EEM_SOLAR_CONVERTER_DO_REMOTE_RESET_EN, "Enable/Disable")
+
+enum eem_system_ai {
+    EEM_SYSTEM_AI(EEM_INDEX)
+    EEM_SYSTEM_AI_COUNT
+};
+enum eem_system_ao {
+    EEM_SYSTEM_AO(EEM_INDEX)
+    EEM_SYSTEM_AO_COUNT
+};
+enum eem_system_di {
+    EEM_SYSTEM_DI(EEM_INDEX)
+    EEM_SYSTEM_DI_COUNT
+};
+enum eem_system_do {
+    EEM_SYSTEM_DO(EEM_INDEX)
+    EEM_SYSTEM_DO_COUNT
+};
+enum eem_rectifier_group_ai {
+    EEM_RECTIFIER_GROUP_AI(EEM_INDEX)
+    EEM_RECTIFIER_GROUP_AI_COUNT
+};
+enum eem_rectifier_group_ao {
+    EEM_RECTIFIER_GROUP_AO(EEM_INDEX)
+    EEM_RECTIFIER_GROUP_AO_COUNT
+};
+enum eem_rectifier_group_di {
+    EEM_RECTIFIER_GROUP_DI(EEM_INDEX)
+    EEM_RECTIFIER_GROUP_DI_COUNT
+};
+enum eem_rectifier_group_do {
+    EEM_RECTIFIER_GROUP_DO(EEM_INDEX)
+    EEM_RECTIFIER_GROUP_DO_COUNT
+};
+enum eem_rectifier_ai {
+    EEM_RECTIFIER_AI(EEM_INDEX)
+    EEM_RECTIFIER_AI_COUNT
+};
+enum eem_rectifier_ao {
+    EEM_RECTIFIER_AO(EEM_INDEX)
+    EEM_RECTIFIER_AO_COUNT
+};
+enum eem_rectifier_di {
+    EEM_RECTIFIER_DI(EEM_INDEX)
+    EEM_RECTIFIER_DI_COUNT
+};
+enum eem_rectifier_do {
+    EEM_RECTIFIER_DO(EEM_INDEX)
+    EEM_RECTIFIER_DO_COUNT
+};
+enum eem_battery_group_ai {
+    EEM_BATTERY_GROUP_AI(EEM_INDEX)
+    EEM_BATTERY_GROUP_AI_COUNT
+};
+enum eem_battery_group_ao {
+    EEM_BATTERY_GROUP_AO(EEM_INDEX)
+    EEM_BATTERY_GROUP_AO_COUNT
+};
+enum eem_battery_group_di {
+    EEM_BATTERY_GROUP_DI(EEM_INDEX)
+    EEM_BATTERY_GROUP_DI_COUNT
+};
+enum eem_battery_group_do {
+    EEM_BATTERY_GROUP_DO(EEM_INDEX)
+    EEM_BATTERY_GROUP_DO_COUNT
+};
+enum eem_battery_unit_ai {
+    EEM_BATTERY_UNIT_AI(EEM_INDEX)
+    EEM_BATTERY_UNIT_AI_COUNT
+};
+enum eem_battery_unit_ao {
+    EEM_BATTERY_UNIT_AO(EEM_INDEX)
+    EEM_BATTERY_UNIT_AO_COUNT
+};
+enum eem_battery_unit_di {
+    EEM_BATTERY_UNIT_DI(EEM_INDEX)
+    EEM_BATTERY_UNIT_DI_COUNT
+};
+enum eem_dc_distribution_group_ai {
+    EEM_DC_DISTRIBUTION_GROUP_AI(EEM_INDEX)
+    EEM_DC_DISTRIBUTION_GROUP_AI_COUNT
+};
+enum eem_eib_distribution_unit_ai {
+    EEM_EIB_DISTRIBUTION_UNIT_AI(EEM_INDEX)
+    EEM_EIB_DISTRIBUTION_UNIT_AI_COUNT
+};
+enum eem_dc_distribution_fuse_unit_ai {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_AI(EEM_INDEX)
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_AI_COUNT
+};
+enum eem_dc_distribution_fuse_unit_di {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DI(EEM_INDEX)
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DI_COUNT
+};
+enum eem_dc_distribution_fuse_unit_do {
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DO(EEM_INDEX)
+    EEM_DC_DISTRIBUTION_FUSE_UNIT_DO_COUNT
+};
+enum eem_battery_fuse_group_ai {
+    EEM_BATTERY_FUSE_GROUP_AI(EEM_INDEX)
+    EEM_BATTERY_FUSE_GROUP_AI_COUNT
+};
+enum eem_battery_fuse_unit_ai {
+    EEM_BATTERY_FUSE_UNIT_AI(EEM_INDEX)
+    EEM_BATTERY_FUSE_UNIT_AI_COUNT
+};
+enum eem_battery_fuse_unit_di {
+    EEM_BATTERY_FUSE_UNIT_DI(EEM_INDEX)
+    EEM_BATTERY_FUSE_UNIT_DI_COUNT
+};
+enum eem_lvd_group_ao {
+    EEM_LVD_GROUP_AO(EEM_INDEX)
+    EEM_LVD_GROUP_AO_COUNT
+};
+enum eem_lvd_group_di {
+    EEM_LVD_GROUP_DI(EEM_INDEX)
+    EEM_LVD_GROUP_DI_COUNT
+};
+enum eem_lvd_group_do {
+    EEM_LVD_GROUP_DO(EEM_INDEX)
+    EEM_LVD_GROUP_DO_COUNT
+};
+enum eem_lvd_unit_ao {
+    EEM_LVD_UNIT_AO(EEM_INDEX)
+    EEM_LVD_UNIT_AO_COUNT
+};
+enum eem_lvd_unit_di {
+    EEM_LVD_UNIT_DI(EEM_INDEX)
+    EEM_LVD_UNIT_DI_COUNT
+};
+enum eem_lvd_unit_do {
+    EEM_LVD_UNIT_DO(EEM_INDEX)
+    EEM_LVD_UNIT_DO_COUNT
+};
+enum eem_ac_group_ai {
+    EEM_AC_GROUP_AI(EEM_INDEX)
+    EEM_AC_GROUP_AI_COUNT
+};
+enum eem_rectifier_ac_ai {
+    EEM_RECTIFIER_AC_AI(EEM_INDEX)
+    EEM_RECTIFIER_AC_AI_COUNT
+};
+enum eem_rectifier_ac_ao {
+    EEM_RECTIFIER_AC_AO(EEM_INDEX)
+    EEM_RECTIFIER_AC_AO_COUNT
+};
+enum eem_rectifier_ac_di {
+    EEM_RECTIFIER_AC_DI(EEM_INDEX)
+    EEM_RECTIFIER_AC_DI_COUNT
+};
+enum eem_rectifier_ac_do {
+    EEM_RECTIFIER_AC_DO(EEM_INDEX)
+    EEM_RECTIFIER_AC_DO_COUNT
+};
+enum eem_ob_ac_unit_ai {
+    EEM_OB_AC_UNIT_AI(EEM_INDEX)
+    EEM_OB_AC_UNIT_AI_COUNT
+};
+enum eem_ob_ac_unit_ao {
+    EEM_OB_AC_UNIT_AO(EEM_INDEX)
+    EEM_OB_AC_UNIT_AO_COUNT
+};
+enum eem_ob_ac_unit_di {
+    EEM_OB_AC_UNIT_DI(EEM_INDEX)
+    EEM_OB_AC_UNIT_DI_COUNT
+};
+enum eem_ob_ac_unit_do {
+    EEM_OB_AC_UNIT_DO(EEM_INDEX)
+    EEM_OB_AC_UNIT_DO_COUNT
+};
+enum eem_solar_converter_group_ai {
+    EEM_SOLAR_CONVERTER_GROUP_AI(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_GROUP_AI_COUNT
+};
+enum eem_solar_converter_group_di {
+    EEM_SOLAR_CONVERTER_GROUP_DI(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_GROUP_DI_COUNT
+};
+enum eem_solar_converter_group_do {
+    EEM_SOLAR_CONVERTER_GROUP_DO(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_GROUP_DO_COUNT
+};
+enum eem_solar_converter_ai {
+    EEM_SOLAR_CONVERTER_AI(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_AI_COUNT
+};
+enum eem_solar_converter_di {
+    EEM_SOLAR_CONVERTER_DI(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_DI_COUNT
+};
+enum eem_solar_converter_do {
+    EEM_SOLAR_CONVERTER_DO(EEM_INDEX)
+    EEM_SOLAR_CONVERTER_DO_COUNT
+};
+
+#endif
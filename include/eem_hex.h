@@ -0,0 +1,321 @@
+#ifndef EEM_HEX_H
+#define EEM_HEX_H
+
+/*
+ * Batch decoding of EEM analog values. A value is sent as 8 hex digits:
+ * a 24 bit two's complement mantissa followed by an 8 bit exponent. A run
+ * of them is turned into words and then into floats in bulk, 8 at a time
+ * with AVX2 or 4 at a time with SSE4.1 when the CPU has them, and by a
+ * scalar loop for the tail and on other targets. Results are bit-exact
+ * with eem_atof(), including the 0x7FFFFF80 NaN sentinel. The encoder at
+ * the end goes the other way for WB, with bit operations and a table of
+ * digit pairs rather than printf.
+ * Shared by the C engine and the C++ parser, hence plain C.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define EEM_HEX_X86 1
+#endif
+
+#define EEM_HEX_DIGITS 8
+#define EEM_HEX_NAN_WORD 0x7FFFFF80
+#define EEM_HEX_NAN_BITS 0x7FC00000u
+
+/**
+ * @brief Convert an EEM word to a float, the reference conversion
+ * @param ul	Word as returned by strtoul()
+ * @return	The value, NaN for the 0x7FFFFF80 sentinel
+ */
+static inline float
+eem_hex_atof_ul(unsigned long ul)
+{
+    int32_t m;
+    uint32_t sign = 0;
+    uint32_t e;
+    uint32_t bits;
+    float f;
+    if (!ul) {
+	return 0;
+    }
+    if (ul == EEM_HEX_NAN_WORD) {
+	bits = EEM_HEX_NAN_BITS;
+	memcpy(&f, &bits, sizeof f);
+	return f;
+    }
+    m = (int32_t) ul;
+    m >>= 7;
+    m &= 0xFFFFFFFE;
+    if (m < 0) {
+	m = -m;
+	sign = 0x80000000;
+    }
+    m &= 0x7FFFFE;
+    e = (int8_t)(ul & 0xff) + 126;
+    bits = sign | ((e << 23) & 0x7F800000) | m;
+    memcpy(&f, &bits, sizeof f);
+    return f;
+}
+
+static inline int
+eem_hex_nibble(unsigned char c)
+{
+    unsigned d = c - '0';
+    unsigned a = (c | 0x20) - 'a';
+    if (d < 10) {
+	return d;
+    }
+    return a < 6 ? (int)a + 10 : -1;
+}
+
+/**
+ * @brief Decode one 8 digit value
+ * @param s	EEM_HEX_DIGITS characters, need not be NUL terminated
+ * @return	The value; anything but plain hex digits is left to strtoul()
+ *		so odd input decodes exactly as it always did
+ */
+static inline float
+eem_hex_float(const char *s)
+{
+    char tmp[EEM_HEX_DIGITS + 1];
+    uint32_t w = 0;
+    int i, n;
+    for (i = 0; i < EEM_HEX_DIGITS; i++) {
+	if ((n = eem_hex_nibble(s[i])) < 0) {
+	    memcpy(tmp, s, EEM_HEX_DIGITS);
+	    tmp[EEM_HEX_DIGITS] = '\0';
+	    return eem_hex_atof_ul(strtoul(tmp, NULL, 16));
+	}
+	w = w << 4 | n;
+    }
+    return eem_hex_atof_ul(w);
+}
+
+#ifdef EEM_HEX_X86
+/* ASCII hex to nibbles, all-ones in *ok when every byte was a hex digit */
+__attribute__((target("sse4.1"))) static inline __m128i
+eem_hex_nibbles_sse(__m128i c, int *ok)
+{
+    __m128i lc = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    __m128i a = _mm_sub_epi8(lc, _mm_set1_epi8('a'));
+    __m128i isd = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    __m128i isa = _mm_cmpeq_epi8(_mm_min_epu8(a, _mm_set1_epi8(5)), a);
+    *ok &= _mm_movemask_epi8(_mm_or_si128(isd, isa)) == 0xFFFF;
+    return _mm_blendv_epi8(_mm_add_epi8(a, _mm_set1_epi8(10)), d, isd);
+}
+
+/* 16 digits to 2 words in the low half */
+__attribute__((target("sse4.1"))) static inline __m128i
+eem_hex_words_sse(__m128i nib)
+{
+    __m128i b = _mm_maddubs_epi16(nib, _mm_set1_epi16(0x0110));
+    b = _mm_packus_epi16(b, b);
+    return _mm_shuffle_epi8(b, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+					     3, 2, 1, 0, 7, 6, 5, 4));
+}
+
+/* eem_hex_atof_ul() on 4 words at once, as float bits */
+__attribute__((target("sse4.1"))) static inline __m128i
+eem_hex_bits_sse(__m128i u)
+{
+    __m128i m = _mm_and_si128(_mm_srai_epi32(u, 7), _mm_set1_epi32(-2));
+    __m128i sign = _mm_and_si128(m, _mm_set1_epi32((int)0x80000000u));
+    __m128i e = _mm_srai_epi32(_mm_slli_epi32(u, 24), 24);
+    __m128i bits;
+    m = _mm_and_si128(_mm_abs_epi32(m), _mm_set1_epi32(0x7FFFFE));
+    e = _mm_add_epi32(e, _mm_set1_epi32(126));
+    e = _mm_and_si128(_mm_slli_epi32(e, 23), _mm_set1_epi32(0x7F800000));
+    bits = _mm_or_si128(_mm_or_si128(sign, e), m);
+    bits = _mm_andnot_si128(_mm_cmpeq_epi32(u, _mm_setzero_si128()), bits);
+    return _mm_blendv_epi8(bits, _mm_set1_epi32((int)EEM_HEX_NAN_BITS),
+			   _mm_cmpeq_epi32(u, _mm_set1_epi32(EEM_HEX_NAN_WORD)));
+}
+
+__attribute__((target("sse4.1"))) static inline size_t
+eem_hex_floats_sse(const char *s, size_t count, float *out)
+{
+    size_t i;
+    int ok;
+    for (i = 0; i + 4 <= count; i += 4, s += 4 * EEM_HEX_DIGITS) {
+	__m128i lo, hi;
+	ok = 1;
+	lo = eem_hex_nibbles_sse(_mm_loadu_si128((const __m128i *)s), &ok);
+	hi = eem_hex_nibbles_sse(_mm_loadu_si128((const __m128i *)(s + 16)), &ok);
+	if (!ok) {
+	    out[i] = eem_hex_float(s);
+	    out[i + 1] = eem_hex_float(s + 8);
+	    out[i + 2] = eem_hex_float(s + 16);
+	    out[i + 3] = eem_hex_float(s + 24);
+	    continue;
+	}
+	_mm_storeu_si128((__m128i *)(out + i),
+			 eem_hex_bits_sse(_mm_unpacklo_epi64(eem_hex_words_sse(lo),
+							     eem_hex_words_sse(hi))));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) static inline __m256i
+eem_hex_nibbles_avx2(__m256i c, int *ok)
+{
+    __m256i lc = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+    __m256i d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    __m256i a = _mm256_sub_epi8(lc, _mm256_set1_epi8('a'));
+    __m256i isd = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    __m256i isa = _mm256_cmpeq_epi8(_mm256_min_epu8(a, _mm256_set1_epi8(5)), a);
+    *ok &= _mm256_movemask_epi8(_mm256_or_si256(isd, isa)) == -1;
+    return _mm256_blendv_epi8(_mm256_add_epi8(a, _mm256_set1_epi8(10)), d, isd);
+}
+
+/* 32 digits to 4 words, two in the low half of each 128 bit lane */
+__attribute__((target("avx2"))) static inline __m256i
+eem_hex_words_avx2(__m256i nib)
+{
+    __m256i b = _mm256_maddubs_epi16(nib, _mm256_set1_epi16(0x0110));
+    b = _mm256_packus_epi16(b, b);
+    return _mm256_shuffle_epi8(b, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+						   3, 2, 1, 0, 7, 6, 5, 4,
+						   3, 2, 1, 0, 7, 6, 5, 4,
+						   3, 2, 1, 0, 7, 6, 5, 4));
+}
+
+__attribute__((target("avx2"))) static inline __m256i
+eem_hex_bits_avx2(__m256i u)
+{
+    __m256i m = _mm256_and_si256(_mm256_srai_epi32(u, 7), _mm256_set1_epi32(-2));
+    __m256i sign = _mm256_and_si256(m, _mm256_set1_epi32((int)0x80000000u));
+    __m256i e = _mm256_srai_epi32(_mm256_slli_epi32(u, 24), 24);
+    __m256i bits;
+    m = _mm256_and_si256(_mm256_abs_epi32(m), _mm256_set1_epi32(0x7FFFFE));
+    e = _mm256_add_epi32(e, _mm256_set1_epi32(126));
+    e = _mm256_and_si256(_mm256_slli_epi32(e, 23), _mm256_set1_epi32(0x7F800000));
+    bits = _mm256_or_si256(_mm256_or_si256(sign, e), m);
+    bits = _mm256_andnot_si256(_mm256_cmpeq_epi32(u, _mm256_setzero_si256()), bits);
+    return _mm256_blendv_epi8(bits, _mm256_set1_epi32((int)EEM_HEX_NAN_BITS),
+			      _mm256_cmpeq_epi32(u, _mm256_set1_epi32(EEM_HEX_NAN_WORD)));
+}
+
+__attribute__((target("avx2"))) static inline size_t
+eem_hex_floats_avx2(const char *s, size_t count, float *out)
+{
+    size_t i;
+    size_t j;
+    int ok;
+    for (i = 0; i + 8 <= count; i += 8, s += 8 * EEM_HEX_DIGITS) {
+	__m256i lo, hi, w;
+	ok = 1;
+	lo = eem_hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)s), &ok);
+	hi = eem_hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)(s + 32)), &ok);
+	if (!ok) {
+	    for (j = 0; j < 8; j++) {
+		out[i + j] = eem_hex_float(s + j * EEM_HEX_DIGITS);
+	    }
+	    continue;
+	}
+	/* Lanes hold words 0 1 | 2 3 and 4 5 | 6 7, put them in order */
+	w = _mm256_unpacklo_epi64(eem_hex_words_avx2(lo), eem_hex_words_avx2(hi));
+	w = _mm256_permute4x64_epi64(w, _MM_SHUFFLE(3, 1, 2, 0));
+	_mm256_storeu_si256((__m256i *)(out + i), eem_hex_bits_avx2(w));
+    }
+    return i;
+}
+#endif
+
+/**
+ * @brief Decode a run of 8 digit analog values
+ * @param s	count * EEM_HEX_DIGITS characters
+ * @param count	Number of values
+ * @param out	Storage for count floats
+ */
+static inline void
+eem_hex_floats(const char *s, size_t count, float *out)
+{
+    size_t i = 0;
+#ifdef EEM_HEX_X86
+    if (__builtin_cpu_supports("avx2")) {
+	i = eem_hex_floats_avx2(s, count, out);
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+	i += eem_hex_floats_sse(s + i * EEM_HEX_DIGITS, count - i, out + i);
+    }
+#endif
+    for (; i < count; i++) {
+	out[i] = eem_hex_float(s + i * EEM_HEX_DIGITS);
+    }
+}
+
+
+/**
+ * @brief Convert a float to an EEM word, the inverse of eem_hex_atof_ul()
+ * @param f	Value; the lowest mantissa bit does not survive the trip
+ * @return	The word, 0x7FFFFF80 for NaN
+ */
+static inline uint32_t
+eem_hex_ftou(float f)
+{
+    uint32_t bits;
+    uint32_t m;
+    memcpy(&bits, &f, sizeof bits);
+    if (!(bits & 0x7FFFFFFF)) {
+	return 0;
+    }
+    if ((bits & 0x7F800000) == 0x7F800000 && (bits & 0x7FFFFF)) {
+	return EEM_HEX_NAN_WORD;
+    }
+    m = (bits & 0x7FFFFE) | 0x800000;
+    if (bits >> 31) {
+	m = ((0u - m) & 0xFFFFFF) | 0x1000000;
+    }
+    return m << 7 | (((bits >> 23) - 126) & 0xFF);
+}
+
+/* "00" to "FF", two digits per byte */
+static const char eem_hex_pairs[] =
+    "000102030405060708090A0B0C0D0E0F"
+    "101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F"
+    "303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F"
+    "505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F"
+    "707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F"
+    "909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+    "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+    "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+    "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+/* Write w as EEM_HEX_DIGITS upper case digits, no NUL */
+static inline void
+eem_hex_put_word(uint32_t w, char *out)
+{
+    memcpy(out, eem_hex_pairs + 2 * (w >> 24), 2);
+    memcpy(out + 2, eem_hex_pairs + 2 * (w >> 16 & 0xFF), 2);
+    memcpy(out + 4, eem_hex_pairs + 2 * (w >> 8 & 0xFF), 2);
+    memcpy(out + 6, eem_hex_pairs + 2 * (w & 0xFF), 2);
+}
+
+/**
+ * @brief Encode a run of analog values
+ * @param a	Values
+ * @param count	Number of values
+ * @param out	Room for count * EEM_HEX_DIGITS characters, no NUL is added
+ * @return	count * EEM_HEX_DIGITS
+ */
+static inline size_t
+eem_hex_put_floats(const float *a, size_t count, char *out)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+	eem_hex_put_word(eem_hex_ftou(a[i]), out + i * EEM_HEX_DIGITS);
+    }
+    return count * EEM_HEX_DIGITS;
+}
+
+#endif
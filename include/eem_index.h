@@ -0,0 +1,161 @@
+#ifndef EEM_INDEX_H
+#define EEM_INDEX_H
+
+/*
+ * Open addressing index from a packed 4 character EEM ID to the object
+ * registered under it. Keys sit in their own array, so a probe touches a
+ * few bytes of one cache line rather than a list node per device. The
+ * lists the objects are on stay the order they are walked in; the index
+ * only answers lookups. Linear probing, at most half full, deletion by
+ * backward shift so no tombstones pile up.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define EEM_INDEX_MIN 16	/* Slots allocated on first insert */
+
+struct eem_index {
+    uint32_t *keys;
+    void **vals;		/* NULL marks a free slot */
+    uint32_t mask;		/* Slots - 1, slots being a power of two */
+    uint32_t count;
+};
+
+/**
+ * @brief Pack an EEM ID, e.g. "0201", into a key
+ * @param id	ID, only its first 4 characters count; a shorter one is
+ *		padded with NULs
+ */
+static inline uint32_t
+eem_id_key(const char *id)
+{
+    uint32_t key = 0;
+    size_t i;
+    for (i = 0; i < 4 && id[i]; i++) {
+	key |= (uint32_t)(uint8_t)id[i] << (8 * i);
+    }
+    return key;
+}
+
+static inline uint32_t
+eem_index_slot(const struct eem_index *ix, uint32_t key)
+{
+    return (key * 0x9E3779B1u) >> 16 & ix->mask;
+}
+
+static inline void *
+eem_index_find(const struct eem_index *ix, uint32_t key)
+{
+    uint32_t i;
+    if (!ix->count) {
+	return NULL;
+    }
+    for (i = eem_index_slot(ix, key); ix->vals[i]; i = (i + 1) & ix->mask) {
+	if (ix->keys[i] == key) {
+	    return ix->vals[i];
+	}
+    }
+    return NULL;
+}
+
+static inline void
+eem_index_place(struct eem_index *ix, uint32_t key, void *val)
+{
+    uint32_t i;
+    for (i = eem_index_slot(ix, key); ix->vals[i]; i = (i + 1) & ix->mask) {
+	if (ix->keys[i] == key) {
+	    break;
+	}
+    }
+    if (!ix->vals[i]) {
+	ix->count++;
+    }
+    ix->keys[i] = key;
+    ix->vals[i] = val;
+}
+
+static inline bool
+eem_index_grow(struct eem_index *ix)
+{
+    struct eem_index old = *ix;
+    uint32_t slots = old.vals ? 2 * (old.mask + 1) : EEM_INDEX_MIN;
+    uint32_t i;
+    ix->keys = malloc(slots * sizeof *ix->keys);
+    ix->vals = calloc(slots, sizeof *ix->vals);
+    if (!ix->keys || !ix->vals) {
+	free(ix->keys);
+	free(ix->vals);
+	*ix = old;
+	return false;
+    }
+    ix->mask = slots - 1;
+    ix->count = 0;
+    for (i = 0; old.vals && i <= old.mask; i++) {
+	if (old.vals[i]) {
+	    eem_index_place(ix, old.keys[i], old.vals[i]);
+	}
+    }
+    free(old.keys);
+    free(old.vals);
+    return true;
+}
+
+/**
+ * @brief Register val under key, replacing what was there
+ * @return	false when out of memory
+ */
+static inline bool
+eem_index_put(struct eem_index *ix, uint32_t key, void *val)
+{
+    if ((!ix->vals || 2 * (ix->count + 1) > ix->mask + 1)
+	&& !eem_index_grow(ix)) {
+	return false;
+    }
+    eem_index_place(ix, key, val);
+    return true;
+}
+
+static inline void
+eem_index_del(struct eem_index *ix, uint32_t key)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t home;
+    if (!ix->count) {
+	return;
+    }
+    for (i = eem_index_slot(ix, key); ix->vals[i]; i = (i + 1) & ix->mask) {
+	if (ix->keys[i] == key) {
+	    break;
+	}
+    }
+    if (!ix->vals[i]) {
+	return;
+    }
+    /* Pull back every entry of the run that probed past the hole */
+    for (j = (i + 1) & ix->mask; ix->vals[j]; j = (j + 1) & ix->mask) {
+	home = eem_index_slot(ix, ix->keys[j]);
+	if (((j - home) & ix->mask) >= ((j - i) & ix->mask)) {
+	    ix->keys[i] = ix->keys[j];
+	    ix->vals[i] = ix->vals[j];
+	    i = j;
+	}
+    }
+    ix->vals[i] = NULL;
+    ix->count--;
+}
+
+static inline void
+eem_index_free(struct eem_index *ix)
+{
+    free(ix->keys);
+    free(ix->vals);
+    ix->keys = NULL;
+    ix->vals = NULL;
+    ix->mask = 0;
+    ix->count = 0;
+}
+
+#endif
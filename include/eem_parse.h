@@ -1,6 +1,9 @@
 #ifndef EEM_PARSE_H
 #define EEM_PARSE_H
 
+#include "eem_bits.h"
+#include "eem_blocks.h"
+
 #define EEM_NOBREAK(s) (*s && *s != '!' && *s != '*')
 #define EEM_BLOCKS 16
 #define EEM_STRSZ_MAX 64
@@ -40,20 +43,25 @@ struct eem_device {
     const uint8_t	ao_count;
     const uint8_t	di_count;
     const uint8_t	do_count;
+    /* Names, exactly as many as the counts; NULL when the count is 0 */
     /* Analog Inputs */
-    const char *const	ai_param[EEM_MAX_AI];
+    const char *const	*ai_param;
     /* Analog Outputs */
-    const char *const	ao_param[EEM_MAX_AO];
+    const char *const	*ao_param;
     /* Digital Inputs */
-    const char *const	di_param[EEM_MAX_DI];
+    const char *const	*di_param;
     /* Digital Outputs */
-    const char *const	do_param[EEM_MAX_DO];
+    const char *const	*do_param;
 };
 
 extern const struct eem_device eem_blocks[];
 extern eemid_t eem_getid(const char *);
 extern const char *eem_getfloat(const char *, uint8_t, float **);
-extern const char *eem_getbit(const char *, uint8_t, uint8_t **);
+extern const char *eem_getbit(const char *, uint8_t, eem_bits_t **);
+extern const char *eem_getfloat_delta(const char *, const char *, size_t,
+				      uint8_t, float **, bool *);
+extern const char *eem_getbit_delta(const char *, const char *, size_t,
+				    uint8_t, eem_bits_t **, bool *);
 extern const struct eem_device *eem_device_find(const char *);
 
 #endif
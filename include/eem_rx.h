@@ -0,0 +1,148 @@
+#ifndef EEM_RX_H
+#define EEM_RX_H
+
+/*
+ * Receive side of the EEM link: the control characters, the block check
+ * character and the framer that turns received bytes into frames and
+ * ACK, NAK and EOT events. It needs nothing of the engine, so it can be
+ * fed bytes on its own.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "eem_scan.h"
+
+#define EEM_MTU 1536
+#define SOH 1
+#define STX 2
+#define ETX 3
+#define EOT 4
+#define ENQ 5
+#define ACK 6
+#define NAK 0x15
+#define END '*'
+
+/* Bytes outside any frame; the engine defines it to dump them */
+#ifndef eem_rx_discard
+#define eem_rx_discard(p, n) do {;} while (0)
+#endif
+
+typedef enum {
+    EEM_RX_HUNT,		/* Looking for SOH, ACK, NAK or EOT */
+    EEM_RX_BODY,		/* Collecting frame bytes up to ETX */
+    EEM_RX_BCC			/* Next byte is the block check character */
+} eem_rx_state_t;
+
+typedef enum {
+    EEM_RX_MORE,
+    EEM_RX_FRAME,
+    EEM_RX_ACK,
+    EEM_RX_NAK,
+    EEM_RX_EOT
+} eem_rx_event_t;
+
+/* Per-session receive framer, state survives across read callbacks */
+struct eem_rx {
+    eem_rx_state_t state;
+    uint8_t sum;		/* Running checksum of the frame body */
+    uint8_t bcc;		/* Received block check character */
+    size_t len;			/* Bytes after SOH up to and including ETX */
+    char buf[EEM_MTU + 1];
+};
+
+static const char eem_delimit[] = {SOH, EOT, ACK, NAK, 0};
+
+/**
+ * @brief Turn a running byte sum into the EEM block check character
+ * @param sum	8 bit sum of the checked bytes
+ * @return	checksum
+ */
+static inline uint8_t
+eem_bcc(uint8_t sum)
+{
+    sum &= 0x7F;
+    if (sum < 0x20) {
+	sum += 0x20;
+    }
+    return sum;
+}
+
+/**
+ * @brief Feed received bytes into the session framer
+ * @param rx	Session receive state
+ * @param p	Received bytes
+ * @param len	Number of received bytes
+ * @param used	Set to the number of bytes consumed
+ * @return	EEM_RX_MORE when all bytes were consumed without completing
+ *		an event, otherwise the completed event
+ */
+static inline eem_rx_event_t
+eem_rx_feed(struct eem_rx *rx, const char *p, size_t len, size_t *used)
+{
+    const char *start = p;
+    const char *end = p + len;
+    const char *last;
+    bool etx;
+    size_t n;
+    while (p < end) {
+	switch (rx->state) {
+	case EEM_RX_HUNT:
+	    for (n = 0; p + n < end
+		 && !memchr(eem_delimit, p[n], sizeof eem_delimit - 1); n++);
+	    if (n) {
+		eem_rx_discard(p, n);
+		p += n;
+		break;
+	    }
+	    switch (*p++) {
+	    case SOH:
+		rx->state = EEM_RX_BODY;
+		rx->sum = 0;
+		rx->len = 0;
+		break;
+	    case ACK:
+		*used = p - start;
+		return EEM_RX_ACK;
+	    case NAK:
+		*used = p - start;
+		return EEM_RX_NAK;
+	    default:
+		*used = p - start;
+		return EEM_RX_EOT;
+	    }
+	    break;
+	case EEM_RX_BODY:
+	    /* Find ETX, copy and sum in one pass */
+	    n = end - p < EEM_MTU - rx->len ? (size_t)(end - p) : EEM_MTU - rx->len;
+	    n = eem_scan_body(rx->buf + rx->len, p, n, rx->len, 0, &rx->sum,
+			      NULL, &etx);
+	    rx->len += n;
+	    p += n;
+	    if (etx) {
+		rx->state = EEM_RX_BCC;
+	    } else if (rx->len == EEM_MTU && p < end) {
+		/* Runaway frame, drop it through ETX */
+		eem_rx_discard(rx->buf, rx->len);
+		rx->state = EEM_RX_HUNT;
+		last = memchr(p, ETX, end - p);
+		p = last ? last + 1 : end;
+	    }
+	    break;
+	case EEM_RX_BCC:
+	    rx->bcc = *p++;
+	    rx->state = EEM_RX_HUNT;
+	    /* At least <cc_id>0000 STX ETX */
+	    if (rx->len >= 8) {
+		rx->buf[rx->len] = '\0';
+		*used = p - start;
+		return EEM_RX_FRAME;
+	    }
+	    break;
+	}
+    }
+    *used = len;
+    return EEM_RX_MORE;
+}
+
+#endif
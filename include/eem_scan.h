@@ -0,0 +1,123 @@
+#ifndef EEM_SCAN_H
+#define EEM_SCAN_H
+
+/*
+ * The body of a received frame is read once. That one pass finds ETX,
+ * adds every byte to the running checksum and, if asked, copies the
+ * bytes. It also notes where the field separators ('!', '#' and END)
+ * are, so the parser can jump from field to field without looking at
+ * the bytes again. Runs 16 bytes at a time with SSE2, a byte at a time
+ * elsewhere. Plain C because the C engine and the C++ framer share it.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define EEM_FIELDS_MAX 256	/* Separators indexed per frame */
+#define EEM_SCAN_ETX 0x03
+
+/* Separator offsets of a frame, relative to the start of its payload */
+struct eem_fields {
+    uint16_t count;
+    bool overflow;		/* More separators than fit, index is partial */
+    uint16_t at[EEM_FIELDS_MAX];
+};
+
+static inline void
+eem_fields_reset(struct eem_fields *f)
+{
+    f->count = 0;
+    f->overflow = false;
+}
+
+/* '*' is END */
+static inline bool
+eem_scan_sep(char c)
+{
+    return c == '!' || c == '*' || c == '#';
+}
+
+static inline void
+eem_fields_add(struct eem_fields *f, size_t pos, size_t origin)
+{
+    if (pos < origin) {
+	return;
+    }
+    if (f->count < EEM_FIELDS_MAX) {
+	f->at[f->count++] = (uint16_t)(pos - origin);
+    } else {
+	f->overflow = true;
+    }
+}
+
+/**
+ * @brief Scan frame body bytes up to and including ETX
+ * @param dst	Where to copy the bytes, NULL to leave them where they are
+ * @param src	Bytes received
+ * @param n	Number of bytes received
+ * @param pos	Offset of src[0] in the frame
+ * @param origin	Offset of the payload in the frame; separators before it
+ *		are not indexed
+ * @param sum	Running 8 bit sum of the frame, updated
+ * @param fields	Separator index, updated; NULL to skip indexing
+ * @param etx	Set when ETX was found
+ * @return	Bytes consumed, ETX included
+ */
+static inline size_t
+eem_scan_body(char *dst, const char *src, size_t n, size_t pos,
+	      size_t origin, uint8_t *sum, struct eem_fields *fields,
+	      bool *etx)
+{
+    size_t i = 0;
+    unsigned s = *sum;
+    char c;
+#ifdef __SSE2__
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+	__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+	unsigned sep;
+	/* The block holding ETX is finished byte by byte below */
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(EEM_SCAN_ETX)))) {
+	    break;
+	}
+	acc = _mm_add_epi64(acc, _mm_sad_epu8(v, _mm_setzero_si128()));
+	if (dst) {
+	    _mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+	if (fields) {
+	    sep = _mm_movemask_epi8(
+		_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('!')),
+					  _mm_cmpeq_epi8(v, _mm_set1_epi8('*'))),
+			     _mm_cmpeq_epi8(v, _mm_set1_epi8('#'))));
+	    for (; sep; sep &= sep - 1) {
+		eem_fields_add(fields, pos + i + __builtin_ctz(sep), origin);
+	    }
+	}
+    }
+    s += (unsigned)_mm_cvtsi128_si32(acc)
+	+ (unsigned)_mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc));
+#endif
+    for (; i < n; i++) {
+	c = src[i];
+	s += (uint8_t)c;
+	if (dst) {
+	    dst[i] = c;
+	}
+	if (fields && eem_scan_sep(c)) {
+	    eem_fields_add(fields, pos + i, origin);
+	}
+	if (c == EEM_SCAN_ETX) {
+	    *etx = true;
+	    *sum = (uint8_t)s;
+	    return i + 1;
+	}
+    }
+    *etx = false;
+    *sum = (uint8_t)s;
+    return n;
+}
+
+#endif
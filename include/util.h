@@ -2,6 +2,7 @@
 #include <iostream>
 #include <event2/event.h>
 #include <sstream>
+#include <cstdint>
 
 namespace util
 {
@@ -12,5 +13,6 @@ namespace util
         NumOfStatus
     };
     void evtimer_sec_add(struct event *event, time_t sec);
+    void evtimer_ms_add(struct event *event, uint32_t ms);
 }
 
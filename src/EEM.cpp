@@ -16,16 +16,14 @@ EEM_Init(void)
     std::cout << "EEM Init!!"<<std::endl;
 }
 
-Eem::Eem(string _server, int _port) : eemStatus(EemState::EEM_INACTIVE)
+Eem::Eem(string _server, int _port, string _cc_id, struct event_base *_base,
+         ReconnectPolicy *_reconnect) :
+eemStatus(EemState::EEM_INACTIVE), cc_id(_cc_id), evBase(_base),
+reconnectPolicy(_reconnect), reconnectAttempts(0),
+eemReq(EemClassReq::Poll, SelectClassCommand::NONE, _cc_id)
 {
-    EemSocket = new SocketBase(_server, _port);
-    connect_timeout_ev = evtimer_new(baseEvent::get_baseEvent(), connect_timeout, this);
-
-    
-    if (eemStatus == EemState::EEM_INACTIVE && connect_timeout_ev)
-    {
-        util::evtimer_sec_add(connect_timeout_ev, 5);
-    }
+    EemSocket = new SocketBase(_server, _port, evBase);
+    connect_timeout_ev = evtimer_new(evBase, connect_timeout, this);
 }
 
 Eem::~Eem()
@@ -33,6 +31,10 @@ Eem::~Eem()
     try
     {
         cout << "Eem Destructor called!" << endl;
+        if (connect_timeout_ev)
+        {
+            event_free(connect_timeout_ev);
+        }
         delete EemSocket;
     }
     catch(const std::exception& e)
@@ -51,12 +53,38 @@ Eem::connect()
 
 }
 
+/* Connect once delayMs passed and the fleet hands out a connect token */
+void
+Eem::scheduleConnect(uint32_t delayMs)
+{
+    if (connect_timeout_ev)
+    {
+        evtimer_del(connect_timeout_ev);
+        util::evtimer_ms_add(connect_timeout_ev, delayMs);
+    }
+}
+
+void
+Eem::reconnectLater()
+{
+    scheduleConnect(reconnectPolicy
+                    ? reconnectPolicy->backoffMs(reconnectAttempts++)
+                    : EEM_RECONNECT_MS);
+}
+
 void
 Eem::connect_timeout(int fd , short what , void *arg)
 {
     Eem *self = static_cast<Eem*>(arg);
+    uint32_t waitMs;
+
     if (self->eemStatus==EemState::EEM_INACTIVE)
     {
+        if (self->reconnectPolicy && !self->reconnectPolicy->acquire(waitMs))
+        {
+            self->scheduleConnect(waitMs);
+            return;
+        }
         self->EemSocket->setBuffereventNull();
         cout << "Eem connect again!" << endl;
         self->connect();
@@ -68,76 +96,112 @@ Eem::close()
 {
     EemSocket->closeBev();
     // eemReq.cleanBufferevent()
+    framer.reset();
     eemStatus=EemState::EEM_INACTIVE;
+    reconnectLater();
+}
 
+/* Close the session for good, without re-arming the reconnect timer */
+void
+Eem::stop()
+{
     if (connect_timeout_ev)
     {
-        util::evtimer_sec_add(connect_timeout_ev, 5);
+        evtimer_del(connect_timeout_ev);
     }
+    EemSocket->closeBev();
+    framer.reset();
+    eemStatus = EemState::EEM_INACTIVE;
+    request_queue.clear();
 }
 
+/*
+ * Frames are located in place in the input evbuffer chains and parsed from
+ * there; the framer copies only frames that straddle chains or reads. Input
+ * is drained once every event found in it has been handled.
+ */
 void
 Eem::readCb(struct bufferevent *bev, void *arg)
 {
     cout << "Usao u readCb" << endl;
     Eem *self = static_cast<Eem*>(arg);
-    EemReq req;
-    // eem_callback callback;
-    // size_t len;
-    size_t prelen;
-    size_t plen;
-    char *start;
-    char *end;
-    int *data_int = new int[2*EEM_MTU];
-    static size_t count;
-    int n;
-
-    static char buf[2 * EEM_MTU];
-    size_t len;
-    uint8_t *data_t = new uint8_t[2*EEM_MTU];
-
-  
     struct evbuffer *input = bufferevent_get_input(bev);
-    std::vector<char> recvData(EEM_MTU);
-    recvData.erase(recvData.begin(), recvData.begin() + len);
-
-    len = evbuffer_get_length(input);
-    evbuffer_copyout(input, recvData.data(),EEM_MTU -1);
-
-    recvData.erase(recvData.begin(), recvData.begin() + count);
-    cout << "Data: " << std::hex << recvData.data() << endl;
+    struct evbuffer_iovec chunks[EEM_READ_CHUNKS];
+    size_t consumed;
+    size_t used;
+    size_t len;
+    char *p;
+    int n;
 
-    count = count + len;
-    cout << "Len:" << len << endl;
-    cout << "Count:" << count << endl;
-    switch (recvData[0])
+    while ((n = evbuffer_peek(input, -1, NULL, chunks, EEM_READ_CHUNKS)) > 0)
+    {
+        consumed = 0;
+        for (int i = 0; i < n && i < EEM_READ_CHUNKS; i++)
+        {
+            p = static_cast<char *>(chunks[i].iov_base);
+            len = chunks[i].iov_len;
+            consumed += len;
+            while (len)
+            {
+                FramerEvent event = self->framer.feed(p, len, used);
+                p += used;
+                len -= used;
+                if (self->handleEvent(event) != util::ErrorStatus::Success)
                 {
-                    case SOH:
-                        cout << "SOH///////////" << endl;
-                        self->eemReq.sendACK(self->EemSocket->getBufferevent());
-                        cout << "Size of vector: " << recvData.size() << endl;
-                        req = self->request_queue.front();
-                        if (req.pickParser(recvData.data(), recvData.size()) 
-                                            == util::ErrorStatus::Success)
-                        {
-                            self->request_queue.erase(self->request_queue.begin(),
-                                            self->request_queue.begin()+1);
-                            cout << "Number of elements:" << self->request_queue.size() << endl;
-                        }
-                        
-                        break;
-                    case ACK:
-                        cout << "Send Poll now!" << endl;
-                        self->eemReq.sendPoll(self->EemSocket->getBufferevent());
-                        
-                        break;
-                    case EOT:
-                        cout << "End of Transmission!!!\nSend next!!" << endl;
-                    
-                    // default:
-                        // cout << "Default" << endl;
+                    return;
                 }
+            }
+        }
+        evbuffer_drain(input, consumed);
+    }
+}
 
+/* React to one framer event; Failed means the session is gone */
+util::ErrorStatus
+Eem::handleEvent(FramerEvent event)
+{
+    switch (event)
+    {
+        case FramerEvent::Frame:
+            cout << "SOH///////////" << endl;
+            if (!framer.checksumOk())
+            {
+                cout << "Incorrect checksum " << std::hex
+                     << (int)framer.receivedChecksum() << " != "
+                     << (int)framer.checksum() << std::dec << endl;
+            }
+            eemReq.sendACK(EemSocket->getBufferevent());
+            if (!request_queue.empty())
+            {
+                request_queue.front().pickParser(framer.payload(),
+                                                 framer.payloadLen(),
+                                                 &framer.fields());
+                request_queue.pop();
+                cout << "Number of elements:" << request_queue.size() << endl;
+            }
+            break;
+        case FramerEvent::Ack:
+            cout << "Send Poll now!" << endl;
+            if (!request_queue.empty())
+            {
+                eemReq.sendPoll(EemSocket->getBufferevent());
+            }
+            break;
+        case FramerEvent::Nak:
+            cout << "NAK" << endl;
+            break;
+        case FramerEvent::Eot:
+            cout << "End of Transmission!!!\nSend next!!" << endl;
+            if (!request_queue.empty())
+            {
+                sendNextReq();
+            }
+            break;
+        case FramerEvent::NeedMore:
+            break;
+    }
+    return eemStatus == EemState::EEM_CONNECTED ? util::ErrorStatus::Success
+                                                 : util::ErrorStatus::Failed;
 }
 
 void
@@ -145,26 +209,15 @@ Eem::eventCb(struct bufferevent *bev, short events, void *arg)
 {
     cout << "Usao u eventCb" << endl;
     Eem *self = static_cast<Eem*>(arg);
-    EemReq req;
-    bool noReqYet;
     if (events & BEV_EVENT_CONNECTED)
     {
         cout << "EEM connected!" << endl;
         self->eemStatus = EemState::EEM_CONNECTED;
+        self->reconnectAttempts = 0;
         evtimer_del(self->connect_timeout_ev);
-        req = EemReq(EemClassReq::FastSelect, 
-                            SelectClassCommand::ReadBlockIdentifications);
-        noReqYet = self->request_queue.empty();
-        self->request_queue.push_back(req);
-
-        if (noReqYet)
-        {
-            //default
-            //Send neqt req!
-            cout << "Empty list, send first!" << endl;
-            self->sendNextReq();
-        }
-
+        self->queueRequest(EemReq(EemClassReq::FastSelect,
+                                  SelectClassCommand::ReadBlockIdentifications,
+                                  self->cc_id));
         return;
     }
     else if(events & BEV_EVENT_ERROR)
@@ -181,6 +234,10 @@ Eem::eventCb(struct bufferevent *bev, short events, void *arg)
         printf("unknown error %d\n", events);
     }
     printf("End!\n");
+    if (events & (BEV_EVENT_ERROR | BEV_EVENT_EOF))
+    {
+        self->close();
+    }
 }
 
 util::ErrorStatus
@@ -192,14 +249,36 @@ Eem::write(const void *data, size_t size)
 util::ErrorStatus
 Eem::sendNextReq()
 {
-    EemReq req;
-    req = this->request_queue.front();
-    util::ErrorStatus status;
-    status = req.sendReq(this->EemSocket->getBufferevent());
-    this->request_queue.erase(this->request_queue.begin());
-
-    return status;
+    /* The request stays queued until its response frame arrives */
+    return this->request_queue.front().sendReq(this->EemSocket->getBufferevent());
 
 }
 
+/*
+ * Queue a request and start the transaction right away when the line is
+ * idle. Fails without queueing when the session already has
+ * EEM_QUEUE_DEPTH requests outstanding. A read identical to one queued
+ * or in flight is not queued: the response to that one is parsed the
+ * same way.
+ */
+util::ErrorStatus
+Eem::queueRequest(EemReq &&req)
+{
+    bool idle = request_queue.empty();
 
+    if (request_queue.any([&req](const EemReq &queued)
+                          { return queued.sameRead(req); }))
+    {
+        return util::ErrorStatus::Success;
+    }
+    if (request_queue.push(std::move(req)) != util::ErrorStatus::Success)
+    {
+        cerr << "Eem: request queue full, request dropped" << endl;
+        return util::ErrorStatus::Failed;
+    }
+    if (idle && eemStatus == EemState::EEM_CONNECTED)
+    {
+        return sendNextReq();
+    }
+    return util::ErrorStatus::Success;
+}
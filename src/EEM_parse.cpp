@@ -1,5 +1,10 @@
 #include "EEM_parse.h"
+#include "EemBlock.h"
 #include "EemReq.h"
+#include "EemTokenizer.h"
+#include "eem_hex.h"
+#include <array>
+#include <utility>
 
 
 EemParser::EemParser()
@@ -8,235 +13,139 @@ EemParser::EemParser()
 EemParser::~EemParser()
 {}
 
-util::ErrorStatus
-EemParser::parse_RB(char *buff, size_t len)
+/* Decode into a block of the type of the response and list its analog inputs */
+template <EemBlockId Id>
+static util::ErrorStatus
+parseBlock(const char *buff, size_t len, const eem_fields *index)
 {
-    char tmp[EEM_STRSZ_MAX];
-    const char *s;
-    float *ai_value = nullptr;
-    size_t count = 14;
-    if (!buff) 
-    {
-        printf("Null buffer!\n");
-        std::cerr << "Null buff!\n" << std::endl;
-        return util::ErrorStatus::Failed;
-    }
-    // Izmijenili jer se rusilo na drugom uvjetu -- To check!
-    /*if (!buff || strncasecmp(buff, "ERR", strlen("ERR")))
-    {
-        std::cerr << "Timeout or error received" << std::endl;
-        return util::ErrorStatus::Failed;
-    }*/
-
-    s = eem_getstr(buff, tmp, sizeof tmp); /* Get device ID */
-    /* Get <Status register> from string */
-    s = eem_getstr(s, tmp, sizeof tmp);
-    /* Get <Analog in> from string */
-    s = eem_getfloat(s, count, &ai_value);
+    EemBlock<Id> block;
 
-    if (!ai_value) 
+    if (block.decode(buff, len, index) != util::ErrorStatus::Success)
     {
         std::cerr << "Error while parsing values!" << std::endl;
         return util::ErrorStatus::Failed;
     }
-
-    std::cout << "Parsed analog input values:" << std::endl;
+    std::cout << "Parsed analog input values of " << block.schema.name << ":" << std::endl;
     std::cout << std::fixed << std::setprecision(2);
-    for (int i = 0; i < count; ++i)
+    for (size_t i = 0; i < block.AiCount; ++i)
     {
-        std::cout << ai_value[i] << std::endl;
+        std::cout << block.schema.aiNames[i] << ": " << block.ai[i] << std::endl;
     }
 
     return util::ErrorStatus::Success;
 }
 
-util::ErrorStatus
-EemParser::parse_RI(char *buff, size_t len)
-{
-    std::cout << "Buffer:" << buff << std::endl;
+typedef util::ErrorStatus (*EemBlockParser)(const char *, size_t, const eem_fields *);
 
-    return util::ErrorStatus::Success;
-}
-
-
-int
-EemParser::parse_INT(char *buff, size_t len)
+template <size_t... I>
+static constexpr std::array<EemBlockParser, sizeof...(I)>
+blockParsers(std::index_sequence<I...>)
 {
-    std::cout << "Buffer:" << buff << std::endl;
-
-    return 0;
+    return {{&parseBlock<static_cast<EemBlockId>(I)>...}};
 }
 
-util::ErrorStatus
-EemParser::parse_RN(char *buff, size_t len)
-{
-    // eem_rn(char *buf, size_t len, void *arg)
-// {
-//     struct pwr *pwr = arg;
-//     struct eem *e = pwr->internal;
-//     size_t n;
-//     if (!buf) {
-// 	return;
-//     }
-//     eem_dump(e, buf, len);
-    std::cout << "--->Name of Device1:" << buff << std::endl;
-    buff[len] = '\0';
-    // if (len && (n = strcspn(buff, eem_field_delim))) {
-// 	if (n > sizeof e->name - 1) {
-// 	    n = sizeof e->name - 1;
-	// }
-	// memmove(e->name, buf, n);
-    std::cout << "--->Name of Device:" << buff << std::endl;
-// 	e->name[n] = '\0';
-//     }
-// }
-    // return util::ErrorStatus::Success;
-    return util::ErrorStatus::Success;
-}
+/* One decoder per block type, indexed by EemBlockId */
+static constexpr std::array<EemBlockParser, EEM_BLOCK_TYPES> eemBlockParsers =
+    blockParsers(std::make_index_sequence<EEM_BLOCK_TYPES>());
 
+/* <block id>!<status>!<analog in>!<analog out>!<digital in>!<digital out>* */
 util::ErrorStatus
-EemParser::parseResponse(char *buff=NULL, size_t len=0)
+EemParser::parse_RB(const char *buff, size_t len, const eem_fields *index)
 {
-    std::cout << "Usao u callback!!!!" << std::endl;
-    char tmp[EEM_STRSZ_MAX];
-    const char *s;
-    float *ai_value = nullptr;
-    size_t count = 14;
+    EemTokenizer fields(buff, len, index);
+    std::string_view id;
+    EemBlockId type;
+
     if (!buff) 
     {
         printf("Null buffer!\n");
         std::cerr << "Null buff!\n" << std::endl;
         return util::ErrorStatus::Failed;
     }
-    // Izmijenili jer se rusilo na drugom uvjetu -- To check!
-    /*if (!buff || strncasecmp(buff, "ERR", strlen("ERR")))
+    if (!fields.next(id) || (type = eemBlockOf(id)) == EemBlockId::Unknown)
     {
-        std::cerr << "Timeout or error received" << std::endl;
+        std::cerr << "Unknown block " << id << std::endl;
         return util::ErrorStatus::Failed;
-    }*/
+    }
 
-    s = eem_getstr(buff, tmp, sizeof tmp); /* Get device ID */
-    /* Get <Status register> from string */
-    s = eem_getstr(s, tmp, sizeof tmp);
-    /* Get <Analog in> from string */
-    s = eem_getfloat(s, count, &ai_value);
+    return eemBlockParsers[static_cast<size_t>(type)](buff, len, index);
+}
 
-    if (!ai_value) 
-    {
-        std::cerr << "Error while parsing values!" << std::endl;
-        return util::ErrorStatus::Failed;
-    }
+/* <block id><type>!... one entry per block of the controller */
+util::ErrorStatus
+EemParser::parse_RI(const char *buff, size_t len, const eem_fields *index)
+{
+    EemTokenizer fields(buff, len, index);
+    std::string_view block;
+    size_t blocks = 0;
 
-    std::cout << "Parsed analog input values:" << std::endl;
-    std::cout << std::fixed << std::setprecision(2);
-    for (int i = 0; i < count; ++i)
+    std::cout << "Buffer:" << std::string_view(buff, buff ? len : 0) << std::endl;
+    while (fields.next(block))
     {
-        std::cout << ai_value[i] << std::endl;
+        if (!block.empty())
+        {
+            blocks++;
+        }
     }
+    std::cout << blocks << " blocks identified" << std::endl;
 
     return util::ErrorStatus::Success;
 }
 
-const char *
-EemParser::eem_getstr(const char *s, char *buf, size_t buflen)
+
+int
+EemParser::parse_INT(const char *buff, size_t len)
 {
-    uint32_t i;
+    std::cout << "Buffer:" << std::string_view(buff, buff ? len : 0) << std::endl;
 
-    if (!s) 
-    {
-        buf[0] = '\0';
-        return NULL;
-    }
-    for (i = 0; EEM_NOBREAK(s) && i < buflen; i++) 
-    {
-        buf[i] = *s++;
-    }
-    buf[i] = '\0';
-    if (*s == '!') 
+    return 0;
+}
+
+util::ErrorStatus
+EemParser::parse_RN(const char *buff, size_t len, const eem_fields *index)
+{
+    EemTokenizer fields(buff, len, index);
+    std::string_view name;
+
+    if (!fields.next(name))
     {
-        s++;
+        return util::ErrorStatus::Failed;
     }
+    std::cout << "--->Name of Device:" << name << std::endl;
 
-    return s;
+    return util::ErrorStatus::Success;
 }
 
-
-const char*
-EemParser::eem_getfloat(const char *s, uint8_t count, float **valp)
+util::ErrorStatus
+EemParser::parseResponse(const char *buff, size_t len, const eem_fields *index)
 {
-    char tmp[EEM_STRSZ_MAX];
-    float *val;
+    std::cout << "Usao u callback!!!!" << std::endl;
 
-    if (!s) 
-    {
-        return NULL;
-    }
+    return parse_RB(buff, len, index);
+}
 
-    if (count) 
-    {
-        if (!(val = *valp)) 
-        {
-            if (!(val = (float*)calloc(count, sizeof(float)))) 
-            {
-                return NULL;
-            }
-            *valp = val;
-        }
-        while (EEM_NOBREAK(s) && strlen(s) >= EEM_STRSZ_FLOAT && count--) 
-        {
-            strncpy(tmp, s, EEM_STRSZ_FLOAT);
-            tmp[EEM_STRSZ_FLOAT] = '\0';
-            *val++ = eem_atof(tmp);
-            s += EEM_STRSZ_FLOAT;
-        }
-        while (EEM_NOBREAK(s)) 
-        {
-            s++;
-        }
-    }
-    if (*s == '!') 
+/*
+ * Decode up to count whole 8 digit values of an analog field into val;
+ * a short value at the end of the field is skipped. Returns the number
+ * of values decoded.
+ */
+size_t
+EemParser::eem_getfloat(std::string_view field, size_t count, float *val)
+{
+    if (field.size() / EEM_STRSZ_FLOAT < count)
     {
-        s++;
+        count = field.size() / EEM_STRSZ_FLOAT;
     }
+    eem_hex_floats(field.data(), count, val);
 
-    return s;
+    return count;
 }
 
 
 float
 EemParser::eem_atof(char *s)
 {
-    int32_t m;
-    uint32_t sign = 0;
-    uint32_t e;
-    union {
-        uint32_t u;
-        float f;
-    } u;
-    unsigned long ul = strtoul(s, NULL, 16);
-
-    if (!ul) 
-    {
-        return 0;
-    }
-    if (ul == 0x7FFFFF80) 
-    {
-        return std::nan("");
-    }
-
-    m = (int32_t) ul;
-    m >>= 7;
-    m &= 0xFFFFFFFE;
-    if (m < 0) 
-    {
-        m = -m;
-        sign = 0x80000000;
-    }
-    m &= 0x7FFFFE;
-    e = (int8_t)(ul & 0xff) + 126;
-    u.u = sign | ((e << 23) & 0x7F800000) | m;
-
-    return u.f;
+    return eem_hex_atof_ul(strtoul(s, NULL, 16));
 }
 
 
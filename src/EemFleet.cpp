@@ -0,0 +1,188 @@
+#include "EemFleet.h"
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+string
+EemEndpoint::key() const
+{
+    return server + ":" + to_string(port) + "/" + cc_id;
+}
+
+EemFleet::EemFleet()
+{}
+
+/* Runs on the owning shard: sockets of a session are only touched there */
+static void
+sessionStart(evutil_socket_t fd, short what, void *arg)
+{
+    /* Through the reconnect policy, so a cold start is paced as well */
+    static_cast<Eem*>(arg)->scheduleConnect(0);
+}
+
+static void
+sessionStop(evutil_socket_t fd, short what, void *arg)
+{
+    Eem *session = static_cast<Eem*>(arg);
+    session->stop();
+    delete session;
+}
+
+EemFleet::~EemFleet()
+{
+    stopAll();
+}
+
+util::ErrorStatus
+EemFleet::loadEndpoints(const string &path)
+{
+    ifstream in(path);
+
+    if (!in)
+    {
+        cerr << "EemFleet: cannot open endpoint list " << path << endl;
+        return util::ErrorStatus::Failed;
+    }
+    return loadEndpoints(in);
+}
+
+/*
+ * Endpoint list format, one controller per line:
+ *     <server> <port> <cc_id>
+ * Empty lines and lines starting with '#' are ignored.
+ */
+util::ErrorStatus
+EemFleet::loadEndpoints(istream &in)
+{
+    util::ErrorStatus status = util::ErrorStatus::Success;
+    string line;
+    size_t lineNo = 0;
+
+    while (getline(in, line))
+    {
+        EemEndpoint endpoint;
+        istringstream fields(line);
+
+        lineNo++;
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+        if (!(fields >> endpoint.server >> endpoint.port >> endpoint.cc_id)
+            || endpoint.cc_id.size() != 2)
+        {
+            cerr << "EemFleet: bad endpoint on line " << lineNo << endl;
+            status = util::ErrorStatus::Failed;
+            continue;
+        }
+        if (add(endpoint) != util::ErrorStatus::Success)
+        {
+            status = util::ErrorStatus::Failed;
+        }
+    }
+    cout << "EemFleet: " << endpoints.size() << " endpoints loaded" << endl;
+    return status;
+}
+
+util::ErrorStatus
+EemFleet::add(const EemEndpoint &endpoint)
+{
+    if (!endpoints.emplace(endpoint.key(), endpoint).second)
+    {
+        cerr << "EemFleet: duplicate endpoint " << endpoint.key() << endl;
+        return util::ErrorStatus::Failed;
+    }
+    return util::ErrorStatus::Success;
+}
+
+util::ErrorStatus
+EemFleet::remove(const string &key)
+{
+    stop(key);
+    return endpoints.erase(key) ? util::ErrorStatus::Success
+                                : util::ErrorStatus::Failed;
+}
+
+util::ErrorStatus
+EemFleet::start(const string &key)
+{
+    unordered_map<string, EemEndpoint>::const_iterator it = endpoints.find(key);
+    struct event_base *base;
+    Eem *session;
+
+    if (it == endpoints.end())
+    {
+        return util::ErrorStatus::Failed;
+    }
+    if (sessions.count(key))
+    {
+        /* Already running */
+        return util::ErrorStatus::Success;
+    }
+    base = baseEvent::get_baseEvent(baseEvent::shardOf(key));
+    try
+    {
+        session = new Eem(it->second.server, it->second.port,
+                          it->second.cc_id, base, &reconnect);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "EemFleet: " << key << ": " << e.what() << '\n';
+        return util::ErrorStatus::Failed;
+    }
+    sessions[key].reset(session);
+    baseEvent::runInLoop(base, sessionStart, session);
+
+    return util::ErrorStatus::Success;
+}
+
+util::ErrorStatus
+EemFleet::stop(const string &key)
+{
+    unordered_map<string, unique_ptr<Eem>>::iterator it = sessions.find(key);
+    Eem *session;
+
+    if (it == sessions.end())
+    {
+        return util::ErrorStatus::Failed;
+    }
+    session = it->second.release();
+    sessions.erase(it);
+    baseEvent::runInLoop(session->evBase, sessionStop, session);
+
+    return util::ErrorStatus::Success;
+}
+
+void
+EemFleet::startAll()
+{
+    for (auto &endpoint : endpoints)
+    {
+        start(endpoint.first);
+    }
+    cout << "EemFleet: " << sessions.size() << " sessions, all connected within "
+         << reconnect.recoveryBoundMs(sessions.size()) << " ms of an outage"
+         << endl;
+}
+
+void
+EemFleet::stopAll()
+{
+    Eem *session;
+
+    for (auto &entry : sessions)
+    {
+        session = entry.second.release();
+        baseEvent::runInLoop(session->evBase, sessionStop, session);
+    }
+    sessions.clear();
+}
+
+Eem *
+EemFleet::find(const string &key) const
+{
+    unordered_map<string, unique_ptr<Eem>>::const_iterator it = sessions.find(key);
+
+    return it == sessions.end() ? nullptr : it->second.get();
+}
@@ -0,0 +1,152 @@
+#include "EemFramer.h"
+#include <algorithm>
+#include <cstring>
+
+EemFramer::EemFramer()
+{
+    reset();
+}
+
+EemFramer::~EemFramer()
+{}
+
+void
+EemFramer::reset()
+{
+    state = State::Hunt;
+    sum = 0;
+    bcc = 0;
+    frameLen = 0;
+    skipped = 0;
+    view = nullptr;
+    eem_fields_reset(&index);
+}
+
+uint8_t
+EemFramer::finishChecksum(uint8_t sum)
+{
+    sum &= 0x7F;
+    if (sum < 0x20)
+    {
+        sum += 0x20;
+    }
+    return sum;
+}
+
+/*
+ * Consume bytes from data until an event is complete or data runs out.
+ * used is set to the number of bytes consumed; the caller feeds the rest
+ * again after handling the event.
+ */
+FramerEvent
+EemFramer::feed(const char *data, size_t len, size_t &used)
+{
+    const char *p = data;
+    const char *end = data + len;
+    const char *last;
+    bool etx;
+    size_t n;
+
+    while (p < end)
+    {
+        switch (state)
+        {
+            case State::Hunt:
+                switch (*p++)
+                {
+                    case SOH:
+                        state = State::Body;
+                        sum = 0;
+                        frameLen = 0;
+                        eem_fields_reset(&index);
+                        view = p;
+                        break;
+                    case ACK:
+                        used = p - data;
+                        return FramerEvent::Ack;
+                    case NAK:
+                        used = p - data;
+                        return FramerEvent::Nak;
+                    case EOT:
+                        used = p - data;
+                        return FramerEvent::Eot;
+                    default:
+                        skipped++;
+                        break;
+                }
+                break;
+            case State::Body:
+                /* ETX, checksum, copy and field index in one pass */
+                n = eem_scan_body(view ? nullptr : frame + frameLen, p,
+                                  std::min<size_t>(end - p, EEM_MTU - frameLen),
+                                  frameLen, EEM_FRAME_HEADER, &sum, &index,
+                                  &etx);
+                frameLen += n;
+                p += n;
+                if (etx)
+                {
+                    state = State::Bcc;
+                }
+                else if (frameLen == EEM_MTU && p < end)
+                {
+                    /* Runaway frame, drop it through ETX and hunt for the next one */
+                    last = static_cast<const char *>(memchr(p, ETX, end - p));
+                    n = (last ? last + 1 : end) - p;
+                    skipped += frameLen + n;
+                    state = State::Hunt;
+                    view = nullptr;
+                    p += n;
+                }
+                break;
+            case State::Bcc:
+                bcc = static_cast<uint8_t>(*p++);
+                state = State::Hunt;
+                if (frameLen <= EEM_FRAME_HEADER)
+                {
+                    skipped += frameLen;
+                    break;
+                }
+                used = p - data;
+                return FramerEvent::Frame;
+        }
+    }
+    if (view && state != State::Hunt)
+    {
+        /* Frame continues beyond this memory, keep our own copy */
+        memcpy(frame, view, frameLen);
+    }
+    view = nullptr;
+    used = len;
+    return FramerEvent::NeedMore;
+}
+
+const char *
+EemFramer::payload()
+{
+    return (view ? view : frame) + EEM_FRAME_HEADER;
+}
+
+/* Payload runs up to (not including) ETX, the END '*' is part of it */
+size_t
+EemFramer::payloadLen() const
+{
+    return frameLen - EEM_FRAME_HEADER - 1;
+}
+
+uint8_t
+EemFramer::checksum() const
+{
+    return finishChecksum(sum);
+}
+
+uint8_t
+EemFramer::receivedChecksum() const
+{
+    return bcc;
+}
+
+bool
+EemFramer::checksumOk() const
+{
+    return checksum() == bcc;
+}
@@ -3,13 +3,20 @@
 #include <cstring>
 #include <cmath>
 
-EemReq::EemReq()
+EemReq::EemReq() : messageLen(0), ccId("01"), blockId("0000")
 {
-
+    requestType.req = EemClassReq::Poll;
+    requestType.selectRequest = SelectClassCommand::NONE;
 }
 
-EemReq::EemReq(EemClassReq _reqType, SelectClassCommand _selectType)
+EemReq::EemReq(EemClassReq _reqType, SelectClassCommand _selectType,
+               const std::string &_ccId, const char *_blockId) :
+messageLen(0)
 {
+    strncpy(ccId, _ccId.c_str(), sizeof ccId - 1);
+    ccId[sizeof ccId - 1] = '\0';
+    strncpy(blockId, _blockId, sizeof blockId - 1);
+    blockId[sizeof blockId - 1] = '\0';
     requestType.req = _reqType;
     requestType.selectRequest = _selectType;
     this->prepareMessage();
@@ -26,7 +33,7 @@ EemReq::prepareMessage()
 
     if (this->requestType.selectRequest != SelectClassCommand::NONE)
     {
-        this->message = this->prepareSelect(requestType.selectRequest);
+        return this->prepareSelect(requestType.selectRequest);
     }
     else if(this->requestType.req == EemClassReq::Poll)
     {
@@ -41,15 +48,20 @@ EemReq::prepareMessage()
 util::ErrorStatus
 EemReq::sendPoll(struct bufferevent *bev)
 {
-    const char ccid[] = "010000";
-    std::vector<char> buffData;
-    buffData.push_back(4); // EOT
-    buffData.insert(buffData.end(), ccid, ccid + sizeof(ccid) - 1);
-    buffData.push_back('P'); // Poll
-    buffData.push_back(5); // Enq
+    char buffData[POLL_LEN];
+    char *p = buffData;
+    *p++ = EOT;
+    *p++ = ccId[0];
+    *p++ = ccId[1];
+    *p++ = '0';
+    *p++ = '0';
+    *p++ = '0';
+    *p++ = '0';
+    *p++ = POLL;
+    *p = ENQ;
     std::cout << "Poll prepared!" << std::endl;
 
-    int err = bufferevent_write(bev,(void *)&buffData[0], buffData.size());
+    int err = bufferevent_write(bev, buffData, sizeof buffData);
     if (err < 0)
     {
         return util::ErrorStatus::Failed;
@@ -60,10 +72,29 @@ EemReq::sendPoll(struct bufferevent *bev)
     }
 }
 
+/*
+ * Writes are never shared: each one has to reach the controller. Reads
+ * are the same when their rendered frames are, which covers the command,
+ * the controller and the block.
+ */
+bool
+EemReq::sameRead(const EemReq &other) const
+{
+    if (requestType.selectRequest == SelectClassCommand::NONE
+        || requestType.selectRequest == SelectClassCommand::WriteBlock
+        || requestType.req != other.requestType.req
+        || requestType.selectRequest != other.requestType.selectRequest)
+    {
+        return false;
+    }
+    return messageLen == other.messageLen
+        && !memcmp(message.data(), other.message.data(), messageLen);
+}
+
 util::ErrorStatus
 EemReq::sendReq(struct bufferevent *bev)
 {
-    int err = bufferevent_write(bev,(void *)&this->message[0], this->message.size());
+    int err = bufferevent_write(bev, this->message.data(), this->messageLen);
 
     if (err < 0)
     {
@@ -76,21 +107,21 @@ EemReq::sendReq(struct bufferevent *bev)
 }
 
 util::ErrorStatus
-EemReq::pickParser(char *buff, size_t len)
+EemReq::pickParser(const char *buff, size_t len, const eem_fields *index)
 {
 
     switch (this->requestType.selectRequest)
     {
         case (SelectClassCommand::ReadBlock):
-            this->parse_RB(buff, len);
+            this->parse_RB(buff, len, index);
             return util::ErrorStatus::Success;
             break;
         case (SelectClassCommand::ReadName):
-            this->parse_RN(buff, len);
+            this->parse_RN(buff, len, index);
             return util::ErrorStatus::Success;
             break;
         case (SelectClassCommand::ReadBlockIdentifications):
-            this->parse_RI(buff, len);
+            this->parse_RI(buff, len, index);
             // RI PARSE!
             return util::ErrorStatus::Success;
             break;
@@ -100,32 +131,40 @@ EemReq::pickParser(char *buff, size_t len)
 
 }
 
-std::vector<char>
+template <size_t CmdLen>
+void
+EemReq::render(const EemSelectFrame<CmdLen> &frameTemplate)
+{
+    EemSelectFrame<CmdLen> frame = frameTemplate;
+
+    frame.setCcId(ccId);
+    if (CmdLen > 2)
+    {
+        frame.setArg(2, blockId, CmdLen - 2);
+    }
+    memcpy(message.data(), frame.data(), frame.size());
+    messageLen = frame.size();
+}
+
+util::ErrorStatus
 EemReq::prepareSelect(SelectClassCommand _selectType)
 {
-    std::vector<char> buffData;
-    const char ccid[] = "010000"; // HARDCODED FOR NOW
-    std::string req_str = getSelectType(_selectType);
-    size_t checksumIndex;
-    uint8_t checksum;
-    buffData.push_back(EOT); // EOT
-    buffData.insert(buffData.end(), ccid, ccid + sizeof(ccid) - 1);
-    buffData.push_back('F');
-    buffData.push_back(SOH); // Soh
-    checksumIndex = buffData.size();
-    buffData.insert(buffData.end(), ccid, ccid + sizeof(ccid) - 1);
-    buffData.push_back(STX); // STX
-    std::copy(req_str.begin(), req_str.end(), std::back_inserter(buffData));
-    buffData.push_back('*'); // END
-    buffData.push_back(ETX); // ETX
-    checksum = getCheksum((void *)&buffData[checksumIndex], buffData.size() - checksumIndex);
-    buffData.push_back(checksum);
-    for (auto i = buffData.begin(); i != buffData.end(); ++i)
-    std::cout << *i;
-
-    std::cout << std::endl;
-    std::cout << "Select prepared!" << std::endl;
-    return buffData;
+    switch (_selectType)
+    {
+        case (SelectClassCommand::ReadBlock):
+            render(eemFrameRB);
+            break;
+        case (SelectClassCommand::ReadName):
+            render(eemFrameRN);
+            break;
+        case (SelectClassCommand::ReadBlockIdentifications):
+            render(eemFrameRI);
+            break;
+        default:
+            messageLen = 0;
+            return util::ErrorStatus::Failed;
+    }
+    return util::ErrorStatus::Success;
 }
 
 // int
@@ -144,24 +183,6 @@ parse(char *buff, size_t len)
     return util::ErrorStatus::Success;
 }
 
-std::string
-EemReq::getSelectType(SelectClassCommand selectType)
-{
-   //eem_callback cal;
-    switch (selectType)
-    {
-        case (SelectClassCommand::ReadBlock):
-            return "RB0000";
-        case (SelectClassCommand::ReadName):
-            return "RN";
-        case (SelectClassCommand::ReadBlockIdentifications):
-            return "RI";
-        default:
-            return "";
-    }
-}
-
-
 util::ErrorStatus EemReq::sendACK(struct bufferevent *bev)
 {
 
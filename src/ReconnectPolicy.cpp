@@ -0,0 +1,82 @@
+#include "ReconnectPolicy.h"
+#include <chrono>
+
+using namespace std;
+
+static uint64_t
+nowMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+ReconnectPolicy::ReconnectPolicy(uint32_t _baseMs, uint32_t _maxMs,
+                                 uint32_t _connectsPerSec, uint32_t _burst) :
+baseMs(_baseMs), maxMs(_maxMs), connectsPerSec(_connectsPerSec ? _connectsPerSec : 1),
+burst(_burst ? _burst : 1), stampMs(nowMs()), millitokens(uint64_t(burst) * 1000),
+rng(random_device()())
+{}
+
+uint32_t
+ReconnectPolicy::random(uint32_t max)
+{
+    lock_guard<mutex> guard(lock);
+
+    return uniform_int_distribution<uint32_t>(0, max)(rng);
+}
+
+uint32_t
+ReconnectPolicy::backoffMs(unsigned attempt)
+{
+    uint64_t cap = baseMs;
+
+    while (attempt-- && cap < maxMs)
+    {
+        cap *= 2;
+    }
+    return random(cap < maxMs ? cap : maxMs);
+}
+
+bool
+ReconnectPolicy::acquire(uint32_t &waitMs)
+{
+    uint64_t full = uint64_t(burst) * 1000;
+    uint32_t wait;
+
+    {
+        lock_guard<mutex> guard(lock);
+        /* Read under the lock, a stale clock would refill the bucket */
+        uint64_t now = nowMs();
+
+        if (now > stampMs)
+        {
+            millitokens += (now - stampMs) * connectsPerSec;
+            if (millitokens > full)
+            {
+                millitokens = full;
+            }
+            stampMs = now;
+        }
+        if (millitokens >= 1000)
+        {
+            millitokens -= 1000;
+            return true;
+        }
+        wait = (1000 - millitokens) / connectsPerSec + 1;
+    }
+    /* Jitter the retry too, refused sessions must not come back together */
+    waitMs = wait + random(wait);
+    return false;
+}
+
+/*
+ * Every lost session tries again within maxMs, and the bucket then lets
+ * connectsPerSec of them through per second once the burst is spent.
+ */
+uint64_t
+ReconnectPolicy::recoveryBoundMs(size_t sessions) const
+{
+    uint64_t queued = sessions > burst ? sessions - burst : 0;
+
+    return maxMs + (queued * 1000 + connectsPerSec - 1) / connectsPerSec;
+}
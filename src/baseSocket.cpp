@@ -8,13 +8,12 @@
 
 using namespace std;
 
-SocketBase::SocketBase(string _server, int _port):
-baseSocketConnected(socketUtil::BevStatus::Closed)
+SocketBase::SocketBase(string _server, int _port, struct event_base *_base):
+base(_base), baseSocketConnected(socketUtil::BevStatus::Closed)
 {
-    sin = new sockaddr_in;
-    bev = new bufferevent;
+    sin = new sockaddr_in();
     sin->sin_family = AF_INET;
-    sin->sin_port = htons(2000);
+    sin->sin_port = htons(_port);
 
     
     if(inet_pton(AF_INET, _server.c_str(), &(sin->sin_addr)) <= 0)  
@@ -32,7 +31,6 @@ SocketBase::createBuffevent()
 {
     
     struct bufferevent *tmp_bev;
-    struct event_base* base = baseEvent::get_baseEvent();
     tmp_bev = bufferevent_socket_new(base, -1,
 				 BEV_OPT_CLOSE_ON_FREE | BEV_OPT_CLOSE_ON_EXEC);
 
@@ -68,7 +66,10 @@ SocketBase::~SocketBase()
     {
         cout << "destructor" << endl;
         delete sin;
-        bufferevent_free(bev);
+        if (bev)
+        {
+            bufferevent_free(bev);
+        }
     }
     catch(int e)
     {
@@ -119,7 +120,6 @@ SocketBase::connectSocket(void (*_readCb)(struct bufferevent*, void *),
     struct bufferevent *bev_tmp;
     bev_tmp = getBufferevent();
     int connect;
-    struct event_base* base = baseEvent::get_baseEvent();
     const char* status;
       
 
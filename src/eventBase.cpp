@@ -1,9 +1,14 @@
 #include "baseEvent.h"
+#include <functional>
+#include <event2/thread.h>
 
 using namespace std;
 
 string baseEvent::nameOfBase = "Nikola";
 event_base* baseEvent::ev_base = NULL;
+vector<event_base*> baseEvent::shards;
+vector<thread> baseEvent::workers;
+atomic<bool> baseEvent::running(false);
 
 
 struct event_base*
@@ -12,6 +17,34 @@ baseEvent::get_baseEvent()
     return ev_base;
 }
 
+struct event_base*
+baseEvent::get_baseEvent(size_t shard)
+{
+    if (shards.empty())
+    {
+        return ev_base;
+    }
+    return shards[shard % shards.size()];
+}
+
+size_t
+baseEvent::shardCount()
+{
+    return shards.size();
+}
+
+/* Sessions are pinned by endpoint key, so a controller always lands on the
+ * same loop no matter in which order the fleet is started. */
+size_t
+baseEvent::shardOf(const std::string &key)
+{
+    if (shards.empty())
+    {
+        return 0;
+    }
+    return hash<string>()(key) % shards.size();
+}
+
 std::string
 baseEvent::get_name()
 {
@@ -25,19 +58,86 @@ baseEvent::~baseEvent()
 {}
 
 void
-baseEvent::initBase()
+baseEvent::initBase(size_t numShards)
 {
-    if (!ev_base)
+    if (ev_base)
+    {
+        return;
+    }
+    if (!numShards)
+    {
+        numShards = 1;
+    }
+    if (numShards > 1 && evthread_use_pthreads())
+    {
+        cerr << "baseEvent: no libevent thread support, using one loop" << endl;
+        numShards = 1;
+    }
+    for (size_t i = 0; i < numShards; i++)
+    {
+        struct event_base *base = event_base_new();
+        if (!base)
+        {
+            break;
+        }
+        shards.push_back(base);
+    }
+    if (!shards.empty())
     {
-        baseEvent::ev_base = event_base_new();
+        baseEvent::ev_base = shards[0];
     }
+    cout << "baseEvent: " << shards.size() << " event loop shard(s)" << endl;
 }
 
+void
+baseEvent::worker(struct event_base *base)
+{
+    event_base_loop(base, EVLOOP_NO_EXIT_ON_EMPTY);
+}
+
+/* Run every shard on its own thread and wait until all of them are stopped */
 void
 baseEvent::dispatch_event()
 {
-    if(ev_base)
+    if (!ev_base)
+    {
+        return;
+    }
+    running = true;
+    for (size_t i = 1; i < shards.size(); i++)
+    {
+        workers.push_back(thread(worker, shards[i]));
+    }
+    worker(shards[0]);
+    for (auto &t : workers)
+    {
+        t.join();
+    }
+    workers.clear();
+    running = false;
+}
+
+void
+baseEvent::stop()
+{
+    for (auto base : shards)
+    {
+        event_base_loopbreak(base);
+    }
+}
+
+/*
+ * Execute cb on the thread that owns base. Before the loops are dispatched
+ * there is no owner yet and cb runs right away on the caller.
+ */
+void
+baseEvent::runInLoop(struct event_base *base,
+                     void (*cb)(evutil_socket_t, short, void *), void *arg)
+{
+    struct timeval now = {0, 0};
+
+    if (!running || event_base_once(base, -1, EV_TIMEOUT, cb, arg, &now))
     {
-        event_base_dispatch(ev_base);
+        cb(-1, EV_TIMEOUT, arg);
     }
 }
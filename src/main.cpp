@@ -5,6 +5,7 @@
 #include "baseSocket.h"
 #include "baseEvent.h"
 #include "EEM.h"
+#include "EemFleet.h"
 using namespace std;
 
 // baseEvent::nameOfBase = "Nikkkkkk";
@@ -22,14 +23,24 @@ eventCb(struct bufferevent *bev, short events, void *arg)
 //Multiple definition of main
 int main(int argc, char const *argv[]) 
 { 
-    baseEvent::initBase();
-    std::string server = "192.168.100.100";
-    // server = argv[1];
-    int port = 2000;
-    // port = atoi(argv[2]);
+    // One event loop per core, sessions are spread over them by endpoint
+    baseEvent::initBase(std::thread::hardware_concurrency());
+    EemFleet fleet;
 
-    Eem Vertiv = Eem(server, port);
-    Vertiv.connect();
+    if (argc > 1)
+    {
+        // Endpoint list: "<server> <port> <cc_id>" per line
+        if (fleet.loadEndpoints(argv[1]) != util::ErrorStatus::Success)
+        {
+            cerr << "Some endpoints in " << argv[1] << " were skipped" << endl;
+        }
+    }
+    else
+    {
+        EemEndpoint Vertiv = {"192.168.100.100", 2000, "01"};
+        fleet.add(Vertiv);
+    }
+    fleet.startAll();
 
 
 
@@ -7,3 +7,11 @@ void util::evtimer_sec_add(struct event *event, time_t sec)
         tv.tv_usec = 0;
         evtimer_add(event, &tv);
     };
+
+void util::evtimer_ms_add(struct event *event, uint32_t ms)
+    {
+        struct timeval tv;
+        tv.tv_sec = ms / 1000;
+        tv.tv_usec = (ms % 1000) * 1000;
+        evtimer_add(event, &tv);
+    };
@@ -0,0 +1,151 @@
+/*
+ * Steady-state allocation check of the read path: recorded controller
+ * traffic is fed through Eem::readCb(), so the framer, the request queue
+ * and the parsers run as they do on a live session, and every operator
+ * new of the thread is counted. After EEM_ALLOC_WARMUP poll cycles a
+ * cycle must not allocate. libevent's chain memory comes from malloc()
+ * and is not counted.
+ */
+#include "EEM.h"
+#include "EemFrame.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#ifndef EEM_ALLOC_COUNT
+#error "build with -DEEM_ALLOC_COUNT, see make test"
+#endif
+
+#define EEM_ALLOC_WARMUP 16 /* Poll cycles before allocations count */
+#define EEM_ALLOC_CYCLES 1000
+
+static thread_local size_t allocations;
+
+void *
+operator new(size_t size)
+{
+    void *p;
+
+    allocations++;
+    if (!(p = malloc(size ? size : 1)))
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *
+operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void
+operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void
+operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void
+operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void
+operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/* A controller response as it comes off the line, BCC and EOT included */
+static std::string
+responseFrame(const std::string &payload)
+{
+    std::string body = std::string("010000") + char(STX) + payload + char(ETX);
+    EemReq req;
+
+    return char(SOH) + body + char(req.getCheksum(body.data(), body.size()))
+           + char(EOT);
+}
+
+/* Replies recorded from an ACU+, the requests of one poll cycle */
+static const struct
+{
+    SelectClassCommand command;
+    const char *block;
+    const char *payload;
+} recorded[] = {
+    {SelectClassCommand::ReadBlockIdentifications, "0000",
+     "00000!02000!02011!03000*"},
+    {SelectClassCommand::ReadBlock, "0000",
+     "0000!00!000000000000000000000000C8000008"
+     "0000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000!*"},
+    {SelectClassCommand::ReadBlock, "0200",
+     "0200!00!C8000008C8000008C8000008C8000008C8000008C8000008!*"},
+};
+
+int
+main()
+{
+    struct event_base *base = event_base_new();
+    Eem eem("127.0.0.1", 1, "01", base);
+    struct bufferevent *line[2];
+    struct evbuffer *output = bufferevent_get_output(eem.EemSocket->getBufferevent());
+    std::string frames[sizeof recorded / sizeof recorded[0]];
+    std::streambuf *console = std::cout.rdbuf(nullptr);
+    const char ack = ACK;
+    size_t before;
+    int status = 0;
+
+    /* The controller writes to line[1]; the session reads line[0] */
+    bufferevent_pair_new(base, 0, line);
+    bufferevent_enable(line[0], EV_READ);
+
+    for (size_t i = 0; i < sizeof recorded / sizeof recorded[0]; i++)
+    {
+        frames[i] = responseFrame(recorded[i].payload);
+    }
+    eem.eemStatus = EemState::EEM_CONNECTED;
+    for (int cycle = 0; cycle < EEM_ALLOC_CYCLES && !status; cycle++)
+    {
+        before = allocations;
+        for (size_t i = 0; i < sizeof recorded / sizeof recorded[0]; i++)
+        {
+            eem.queueRequest(EemReq(EemClassReq::FastSelect,
+                                    recorded[i].command, "01",
+                                    recorded[i].block));
+            /* Select acknowledged, then the response to the poll */
+            bufferevent_write(line[1], &ack, 1);
+            Eem::readCb(line[0], &eem);
+            bufferevent_write(line[1], frames[i].data(), frames[i].size());
+            Eem::readCb(line[0], &eem);
+            evbuffer_drain(output, evbuffer_get_length(output));
+        }
+        if (!eem.request_queue.empty())
+        {
+            std::cerr << "alloc_test: cycle " << cycle
+                      << " left requests unanswered" << std::endl;
+            status = 1;
+        }
+        else if (cycle >= EEM_ALLOC_WARMUP && allocations != before)
+        {
+            std::cerr << "alloc_test: cycle " << cycle << " made "
+                      << allocations - before << " heap allocation(s)"
+                      << std::endl;
+            status = 1;
+        }
+    }
+    std::cout.rdbuf(console);
+    bufferevent_free(line[0]);
+    bufferevent_free(line[1]);
+    eem.stop();
+    return status;
+}
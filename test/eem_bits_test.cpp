@@ -0,0 +1,145 @@
+/*
+ * EemBits::decode() against a flag by flag reading of the field, on fixed
+ * fields with known flags and on random fields and previous states: the
+ * most significant bit of each digit is the first value, a size that is
+ * not a multiple of 4 takes the top bits of the last digit, and values a
+ * short field does not reach keep their previous state.
+ */
+#include "EemBlock.h"
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+#define EEM_BITS_FIELDS 100000 /* Random fields checked per size */
+
+static unsigned failures;
+
+static void
+fail(size_t n, const std::string &field, const char *what)
+{
+    if (failures++ < 10)
+    {
+        std::cerr << "EemBits<" << n << ">::decode(\"" << field << "\"): "
+                  << what << std::endl;
+    }
+}
+
+/* Flag i of the field, or -1 when the field does not reach it */
+static int
+reference(const std::string &field, size_t i)
+{
+    const char *hex = "0123456789abcdef";
+    const char *p;
+
+    if (i / 4 >= field.size())
+    {
+        return -1;
+    }
+    p = strchr(hex, tolower(static_cast<unsigned char>(field[i / 4])));
+    if (!p || !*p)
+    {
+        return 0;
+    }
+    return (p - hex) >> (3 - i % 4) & 1;
+}
+
+/* Decode field over prev, each value must be the flag or stay as it was */
+template <size_t N>
+static void
+check(const std::string &field, const EemBits<N> &prev)
+{
+    EemBits<N> bits = prev;
+
+    bits.decode(field);
+    for (size_t i = 0; i < N; i++)
+    {
+        int want = reference(field, i);
+
+        if (bits.test(i) != (want < 0 ? prev.test(i) : want == 1))
+        {
+            fail(N, field, "flags differ");
+            return;
+        }
+    }
+}
+
+/* Decode field over all clear or all set, the set values must be `set` */
+template <size_t N>
+static void
+expect(const std::string &field, bool fill, const std::string &set)
+{
+    EemBits<N> bits;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        bits.set(i, fill);
+    }
+    check(field, bits);
+    bits.decode(field);
+    for (size_t i = 0; i < N; i++)
+    {
+        if (bits.test(i) != (set[i] == '1'))
+        {
+            fail(N, field, "wrong flags");
+            return;
+        }
+    }
+}
+
+template <size_t N>
+static void
+randomFields(std::minstd_rand &rng)
+{
+    static const char digits[] = "0123456789ABCDEFabcdef";
+    EemBits<N> prev;
+    std::string field;
+
+    for (size_t k = 0; k < EEM_BITS_FIELDS; k++)
+    {
+        field.assign(rng() % (N / 4 + 3), '0');
+        for (char &c : field)
+        {
+            c = rng() % 50 ? digits[rng() % (sizeof digits - 1)]
+                           : "G x-"[rng() % 4];
+        }
+        for (size_t i = 0; i < N; i++)
+        {
+            prev.set(i, rng() & 1);
+        }
+        check(field, prev);
+    }
+}
+
+int
+main()
+{
+    std::minstd_rand rng(12);
+
+    /* The first value is the most significant bit of the first digit */
+    expect<4>("8", false, "1000");
+    expect<4>("1", false, "0001");
+    expect<8>("A5", false, "10100101");
+    expect<4>("c", false, "1100");
+    /* A partial last digit gives its top bits */
+    expect<3>("F", false, "111");
+    expect<1>("7", true, "0");
+    expect<5>("FF", false, "11111");
+    /* A short field clears only the values it reaches */
+    expect<12>("0", true, "000011111111");
+    expect<12>("", true, "111111111111");
+    /* Values carry across the word boundary */
+    expect<72>("00000000000000008F", false,
+               std::string(64, '0') + "10001111");
+    /* Anything but a hex digit decodes as no values */
+    expect<8>("G8", true, "00001000");
+
+    randomFields<1>(rng);
+    randomFields<3>(rng);
+    randomFields<13>(rng);
+    randomFields<64>(rng);
+    randomFields<67>(rng);
+    randomFields<128>(rng);
+    return failures != 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * EemFramer on a stream of frames and control characters with stray
+ * bytes in between, fed whole, split in two at every offset and a byte at
+ * a time: each way must give the same events, payloads and separator
+ * index. Frames whose byte sum is below 0x20 check the block check
+ * character, and frames too short or too long must be dropped.
+ */
+#include "EemFramer.h"
+#include "EemProto.h"
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+struct Event
+{
+    FramerEvent type;
+    std::string payload;
+    uint8_t bcc;
+    uint8_t sum;
+    std::vector<uint16_t> fields;
+
+    bool operator==(const Event &o) const
+    {
+        return type == o.type && payload == o.payload && bcc == o.bcc
+            && sum == o.sum && fields == o.fields;
+    }
+};
+
+struct Events
+{
+    std::vector<Event> events;
+    size_t discarded = 0;
+
+    bool operator==(const Events &o) const
+    {
+        return events == o.events && discarded == o.discarded;
+    }
+};
+
+static unsigned failures;
+
+static void
+fail(const std::string &stream, const char *what)
+{
+    if (failures++ < 10)
+    {
+        std::cerr << stream << ": " << what << std::endl;
+    }
+}
+
+static uint8_t
+bccOf(uint8_t sum)
+{
+    sum &= 0x7F;
+    return sum < 0x20 ? sum + 0x20 : sum;
+}
+
+/* An addressed frame with payload and its block check character */
+static std::string
+frame(const std::string &payload)
+{
+    std::string body = std::string("010000") + char(STX) + payload + "*"
+        + char(ETX);
+    uint8_t sum = 0;
+
+    for (char c : body)
+    {
+        sum += static_cast<uint8_t>(c);
+    }
+    return char(SOH) + body + char(bccOf(sum));
+}
+
+/* Feed data in pieces of at most step bytes, split once at split */
+static Events
+feed(const std::string &data, size_t split, size_t step)
+{
+    /* Poisoned, so a frame not copied cannot be read from an earlier run */
+    alignas(EemFramer) static unsigned char mem[sizeof(EemFramer)];
+    memset(mem, 0xA5, sizeof mem);
+    EemFramer &framer = *new (mem) EemFramer;
+    Events ev;
+    size_t off = 0;
+
+    while (off < data.size())
+    {
+        size_t n = std::min(data.size() - off, step);
+
+        if (off < split && off + n > split)
+        {
+            n = split - off;
+        }
+        /* Each piece lives only for its feed() calls, as a read buffer does */
+        std::string piece = data.substr(off, n);
+        const char *p = piece.data();
+
+        while (n)
+        {
+            size_t used;
+            FramerEvent type = framer.feed(p, n, used);
+            Event e{type, "", 0, 0, {}};
+
+            p += used;
+            off += used;
+            n -= used;
+            if (type == FramerEvent::NeedMore)
+            {
+                continue;
+            }
+            if (type == FramerEvent::Frame)
+            {
+                const eem_fields &f = framer.fields();
+
+                e.payload.assign(framer.payload(), framer.payloadLen());
+                e.bcc = framer.receivedChecksum();
+                e.sum = framer.checksum();
+                e.fields.assign(f.at, f.at + f.count);
+            }
+            ev.events.push_back(e);
+        }
+    }
+    ev.discarded = framer.discarded();
+    framer.~EemFramer();
+    return ev;
+}
+
+/* Every way of feeding the stream must give the events of feeding it whole */
+static void
+check(const std::string &name, const std::string &data, const Events &want)
+{
+    if (!(feed(data, data.size(), data.size()) == want))
+    {
+        fail(name, "wrong events fed whole");
+    }
+    for (size_t i = 1; i < data.size(); i++)
+    {
+        if (!(feed(data, i, data.size()) == want))
+        {
+            fail(name, "wrong events when split");
+            break;
+        }
+    }
+    if (!(feed(data, data.size(), 1) == want))
+    {
+        fail(name, "wrong events a byte at a time");
+    }
+}
+
+/* The frame framed by frame() from payload, checksum good */
+static Event
+frameEvent(const std::string &payload)
+{
+    std::string f = frame(payload);
+    Event e{FramerEvent::Frame, payload + "*",
+            static_cast<uint8_t>(f.back()), static_cast<uint8_t>(f.back()),
+            {}};
+
+    for (size_t i = 0; i < e.payload.size(); i++)
+    {
+        if (eem_scan_sep(e.payload[i]))
+        {
+            e.fields.push_back(i);
+        }
+    }
+    return e;
+}
+
+static Event
+controlEvent(FramerEvent type)
+{
+    return Event{type, "", 0, 0, {}};
+}
+
+int
+main()
+{
+    std::string data;
+    Events want;
+    unsigned lows = 0;
+
+    /* Stray bytes before SOH, back to back ACK, EOT and NAK */
+    data = "junk\r\n" + frame("0000!00!4250D6B0") + char(ACK) + char(EOT)
+        + "\xff\x7f" + frame("0200!0002!0003") + char(NAK) + char(EOT)
+        + char(ACK);
+    want.events = {frameEvent("0000!00!4250D6B0"),
+                   controlEvent(FramerEvent::Ack),
+                   controlEvent(FramerEvent::Eot),
+                   frameEvent("0200!0002!0003"),
+                   controlEvent(FramerEvent::Nak),
+                   controlEvent(FramerEvent::Eot),
+                   controlEvent(FramerEvent::Ack)};
+    want.discarded = 8;
+    check("frames and control characters", data, want);
+
+    /* Byte sums that leave less than 0x20 in the low 7 bits */
+    for (char c = '0'; c <= 'z'; c++)
+    {
+        std::string low = std::string("0000!") + c;
+        uint8_t sum = 0;
+
+        data = frame(low);
+        for (size_t i = 1; i < data.size() - 1; i++)
+        {
+            sum += static_cast<uint8_t>(data[i]);
+        }
+        if ((sum & 0x7F) >= 0x20)
+        {
+            continue;
+        }
+        lows++;
+        if (static_cast<uint8_t>(data.back()) != (sum & 0x7F) + 0x20)
+        {
+            fail(low, "block check character not raised by 0x20");
+        }
+        want.events = {frameEvent(low)};
+        want.discarded = 0;
+        check(low, data, want);
+        /* A wrong one is passed on for the caller to report */
+        data.back() = sum & 0x7F;
+        want.events[0].bcc = sum & 0x7F;
+        check(low, data, want);
+    }
+    if (!lows)
+    {
+        fail("low sums", "no frame sums below 0x20");
+    }
+
+    /* Too short to carry an address, dropped */
+    data = std::string{char(SOH), char(STX), char(ETX), ' '} + frame("0100!1");
+    want.events = {frameEvent("0100!1")};
+    want.discarded = 2;
+    check("short frame", data, want);
+
+    /* A frame that overruns EEM_MTU is dropped through its ETX */
+    data = char(SOH) + std::string(EEM_MTU + 10, 'A') + char(ETX) + ' '
+        + frame("0100!2");
+    want.events = {frameEvent("0100!2")};
+    want.discarded = EEM_MTU + 12;
+    check("runaway frame", data, want);
+    return failures != 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * eem_getbit() against the strtol() decoder it replaced, on fixed fields
+ * with known flags and on random fields, counts and previous flags: the
+ * most significant bit of each digit is the first flag, a count that is
+ * not a multiple of 4 takes the top bits of the last digit, and flags a
+ * short field does not reach keep their previous value.
+ */
+#include "eem_parse.c"
+
+#define EEM_GETBIT_FIELDS 200000	/* Random fields checked */
+
+/* The decoder as it was, one flag per byte */
+static const char *
+eem_getbit_strtol(const char *s, uint8_t count, uint8_t *val)
+{
+    char hex[2], byte;
+    uint32_t i;
+
+    if (count) {
+	while (EEM_NOBREAK(s)) {
+	    hex[0] = *s++;
+	    hex[1] = '\0';
+	    byte = (char)strtol(hex, NULL, 16);
+	    for (i = 0; i < 4; i++) {
+		*val++ = (byte & 0x08) != 0;
+		byte <<= 1;
+		if (!--count) {
+		    goto out;
+		}
+	    }
+	}
+    out:
+	while (EEM_NOBREAK(s)) {
+	    s++;
+	}
+    }
+    if (*s == '!') {
+	s++;
+    }
+    return s;
+}
+
+static unsigned failures;
+
+static void
+fail(const char *field, uint8_t count, const char *what)
+{
+    if (failures++ < 10) {
+	fprintf(stderr, "eem_getbit(\"%s\", %u): %s\n", field, count, what);
+    }
+}
+
+/* Decode field over prev with both decoders, the flags must agree */
+static void
+check(const char *field, uint8_t count, const eem_bits_t *prev)
+{
+    eem_bits_t bits = *prev;
+    eem_bits_t *val = &bits;
+    uint8_t old[EEM_BITS_MAX];
+    const char *got;
+    const char *want;
+    size_t i;
+
+    for (i = 0; i < EEM_BITS_MAX; i++) {
+	old[i] = eem_bit(prev, i);
+    }
+    got = eem_getbit(field, count, &val);
+    want = eem_getbit_strtol(field, count, old);
+    if (val != &bits) {
+	fail(field, count, "flags reallocated");
+    }
+    if (got != want) {
+	fail(field, count, "next field differs");
+    }
+    for (i = 0; i < EEM_BITS_MAX; i++) {
+	if (eem_bit(&bits, i) != old[i]) {
+	    fail(field, count, "flags differ");
+	    break;
+	}
+    }
+}
+
+/* Decode field over prev, the flags must be w0 and w1 */
+static void
+expect(const char *field, uint8_t count, const eem_bits_t *prev,
+       uint64_t w0, uint64_t w1)
+{
+    eem_bits_t bits = *prev;
+    eem_bits_t *val = &bits;
+
+    eem_getbit(field, count, &val);
+    if (bits.w[0] != w0 || bits.w[1] != w1) {
+	fail(field, count, "wrong flags");
+    }
+    check(field, count, prev);
+}
+
+int
+main(void)
+{
+    static const char digits[] = "0123456789ABCDEFabcdef";
+    static const char *const ends[] = {"", "!", "*", "!00*", "*!"};
+    const eem_bits_t zero = {{0, 0}};
+    const eem_bits_t ones = {{~0ull, ~0ull}};
+    eem_bits_t prev;
+    eem_bits_t *val = NULL;
+    char field[40];
+    size_t len;
+    size_t i;
+    size_t j;
+    uint8_t count;
+
+    /* The first flag is the most significant bit of the first digit */
+    expect("8", 4, &zero, 0x1, 0);
+    expect("1", 4, &zero, 0x8, 0);
+    expect("A5", 8, &zero, 0xA5, 0);
+    expect("0001", 16, &zero, 0x8000, 0);
+    expect("c", 4, &zero, 0x3, 0);
+    /* A partial last digit gives its top bits, the rest is left alone */
+    expect("F", 3, &zero, 0x7, 0);
+    expect("E", 1, &zero, 0x1, 0);
+    expect("7", 1, &ones, ~1ull, ~0ull);
+    expect("FF", 5, &zero, 0x1F, 0);
+    /* A short field clears only the flags it reaches */
+    expect("0", 12, &ones, ~0xFull, ~0ull);
+    expect("", 12, &ones, ~0ull, ~0ull);
+    expect("!FFF", 12, &zero, 0, 0);
+    /* Flags carry across the word boundary */
+    expect("00000000000000008F", 72, &zero, 0, 0xF1);
+    expect("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", 128, &zero, ~0ull, ~0ull);
+    /* Anything but a hex digit decodes as no flags, as strtol() did */
+    expect("G8", 8, &ones, ~0xFFull | 0x10, ~0ull);
+    /* A missing set of flags is allocated clear */
+    eem_getbit("8", 8, &val);
+    if (!val || val->w[0] != 0x1 || val->w[1]) {
+	fail("8", 8, "wrong flags when allocated");
+    }
+    free(val);
+
+    srandom(12);
+    for (i = 0; i < EEM_GETBIT_FIELDS; i++) {
+	len = random() % 34;
+	for (j = 0; j < len; j++) {
+	    field[j] = random() % 50 ? digits[random() % (sizeof digits - 1)]
+		: "G x-"[random() % 4];
+	}
+	strcpy(field + len, ends[random() % MAXCOUNT(ends)]);
+	count = random() % (EEM_BITS_MAX + 1);
+	prev.w[0] = (uint64_t)random() << 33 ^ (uint64_t)random() << 2 ^ random();
+	prev.w[1] = (uint64_t)random() << 33 ^ (uint64_t)random() << 2 ^ random();
+	check(field, count, &prev);
+    }
+    return failures != 0;
+}
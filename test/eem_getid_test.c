@@ -0,0 +1,68 @@
+/*
+ * eem_getid() against the regcomp() classifier it replaced, for every
+ * 4 digit hex ID, every 5 character ID made by adding a hex digit to one,
+ * and some short and odd strings.
+ */
+#include "eem_parse.c"
+#include <regex.h>
+
+/* The classifier as it was, one regcomp() per dotted code and call */
+static eemid_t
+eem_getid_regex(const char *s)
+{
+    size_t i;
+    const char *code;
+    regex_t rgx;
+    for (i = 0; i < MAXCOUNT(eem_codes); i++) {
+	code = eem_codes[i];
+	if (strchr(code, POINT)) {
+	    if (!regcomp(&rgx, code, 0)
+		&& !regexec(&rgx, s, 0, NULL, 0)) {
+		regfree(&rgx);
+		break;
+	    }
+	    regfree(&rgx);
+	} else if (!strncmp(s, code, strlen(code))) {
+	    break;
+	}
+    }
+    return i;
+}
+
+static unsigned failures;
+
+static void
+check(const char *id)
+{
+    eemid_t got = eem_getid(id);
+    eemid_t want = eem_getid_regex(id);
+    if (got != want && failures++ < 10) {
+	fprintf(stderr, "eem_getid(\"%s\") = %d, regex gives %d\n", id, got,
+		want);
+    }
+}
+
+int
+main(void)
+{
+    static const char *const odd[] = {
+	"", "0", "02", "040", "5F0", "040A", "5F0A", "0400!", "5F0A3!",
+	"0200!00!", "ABCD", "abcd", "04x04", "5F0-3", "....", "0000 ",
+    };
+    char id[6];
+    unsigned n;
+    unsigned d;
+    size_t i;
+    for (n = 0; n <= 0xFFFF; n++) {
+	snprintf(id, sizeof id, "%04X", n);
+	check(id);
+	for (d = 0; d < 16; d++) {
+	    snprintf(id, sizeof id, "%04X%X", n, d);
+	    check(id);
+	}
+    }
+    for (i = 0; i < MAXCOUNT(odd); i++) {
+	check(odd[i]);
+    }
+    return failures != 0;
+}
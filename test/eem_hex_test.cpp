@@ -0,0 +1,195 @@
+/*
+ * The WB float encoder of eem_hex.h against the reference decoder,
+ * EemParser::eem_atof(): values encoded by eem_hex_put_floats() must come
+ * back bit for bit, bar the lowest mantissa bit, and the batch decoders
+ * must read any field, odd ones included, exactly as eem_atof() does.
+ */
+#include "EEM_parse.h"
+#include "eem_hex.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+
+#define EEM_HEX_VALUES 2000000 /* Random values round-tripped */
+#define EEM_HEX_RUN 100 /* Values per encoded run, a full block */
+
+static unsigned failures;
+
+static uint32_t
+bitsOf(float f)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &f, sizeof bits);
+    return bits;
+}
+
+static void
+fail(const std::string &what, float got, float want)
+{
+    if (failures++ < 10)
+    {
+        std::cerr << what << ": " << std::hex << bitsOf(got) << " != "
+                  << bitsOf(want) << std::dec << std::endl;
+    }
+}
+
+/* eem_atof() of the first n characters of s */
+static float
+reference(const char *s, size_t n = EEM_HEX_DIGITS)
+{
+    EemParser parser;
+    char field[EEM_HEX_DIGITS + 1] = {0};
+
+    memcpy(field, s, std::min<size_t>(n, EEM_HEX_DIGITS));
+    return parser.eem_atof(field);
+}
+
+/* A field must decode the same through every decoder */
+static void
+checkField(const char *s)
+{
+    char field[EEM_HEX_DIGITS] = {0};
+    float want;
+    float got;
+
+    memcpy(field, s, std::min<size_t>(strlen(s), EEM_HEX_DIGITS));
+    want = reference(field);
+    if (bitsOf(got = eem_hex_float(field)) != bitsOf(want))
+    {
+        fail(std::string("eem_hex_float(\"") + s + "\")", got, want);
+    }
+}
+
+/* What a float is expected to come back as */
+static float
+expected(float f)
+{
+    uint32_t bits = bitsOf(f);
+
+    if (!(bits & 0x7FFFFFFF))
+    {
+        return 0;
+    }
+    if (std::isnan(f))
+    {
+        bits = EEM_HEX_NAN_BITS;
+    }
+    else
+    {
+        bits &= ~1u;
+    }
+    memcpy(&f, &bits, sizeof f);
+    return f;
+}
+
+/* Encode a run, then decode it value by value and in bulk */
+static void
+roundTrip(const float *a, size_t count)
+{
+    EemParser parser;
+    char text[EEM_HEX_RUN * EEM_HEX_DIGITS];
+    float bulk[EEM_HEX_RUN];
+    float got;
+
+    if (eem_hex_put_floats(a, count, text) != count * EEM_HEX_DIGITS)
+    {
+        failures++;
+        std::cerr << "eem_hex_put_floats: wrong length" << std::endl;
+        return;
+    }
+    parser.eem_getfloat(std::string_view(text, count * EEM_HEX_DIGITS),
+                        count, bulk);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (bitsOf(got = reference(text + i * EEM_HEX_DIGITS))
+            != bitsOf(expected(a[i])))
+        {
+            fail("eem_atof(eem_hex_put_floats(" + std::to_string(a[i]) + "))",
+                 got, expected(a[i]));
+        }
+        if (bitsOf(bulk[i]) != bitsOf(got))
+        {
+            fail("eem_getfloat(" + std::to_string(a[i]) + ")", bulk[i], got);
+        }
+    }
+}
+
+int
+main()
+{
+    static const char *const fields[] = {
+        "50000003", "C8000008", "00000000", "7FFFFF80", "FFFFFFFF",
+        "80000000", "7FFFFFFF", "c8000008", "aBcDeF01",
+        /* Sign */
+        "-0000001", "+5000000", "-C800000",
+        /* Leading and trailing garbage */
+        " 5000000", "!5000000", "x5000000", "5000000!", "500000*3",
+        "50000003garbage",
+        /* Empty field */
+        "",
+        /* Digits past the eighth belong to the next value */
+        "500000037", "FFFFFFFFFFFFFFFF",
+    };
+    static const struct
+    {
+        const char *field;
+        float value;
+    } known[] = {
+        {"00000000", 0}, {"50000003", 5}, {"70000003", 7},
+        {"40000002", 2}, {"C8000008", -240},
+    };
+    std::mt19937 rng(20260417);
+    EemParser parser;
+    float a[EEM_HEX_RUN];
+    float val[EEM_HEX_RUN];
+    uint32_t bits;
+    float f;
+
+    for (const char *field : fields)
+    {
+        checkField(field);
+    }
+    for (const auto &k : known)
+    {
+        if (reference(k.field) != k.value || eem_hex_float(k.field) != k.value)
+        {
+            fail(std::string("decode ") + k.field, eem_hex_float(k.field),
+                 k.value);
+        }
+    }
+    /* An empty field holds no value, a short one at the end is skipped */
+    if (parser.eem_getfloat(std::string_view(""), 1, val) != 0
+        || parser.eem_getfloat(std::string_view("5000000370"), 2, val) != 1
+        || val[0] != 5)
+    {
+        failures++;
+        std::cerr << "eem_getfloat: short fields" << std::endl;
+    }
+
+    /* Signs, zeros, NaN and the ends of the exponent range EEM carries */
+    const float edges[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 5.0f, -240.0f, 53.5f, -0.001f,
+        std::nanf(""), -std::nanf(""), 1e-45f, -1e-45f, 1.17549435e-38f,
+        8.5e37f, -8.5e37f,
+    };
+    roundTrip(edges, sizeof edges / sizeof edges[0]);
+    /* Every exponent EEM can carry, any sign and mantissa */
+    for (size_t n = 0; n < EEM_HEX_VALUES; n += EEM_HEX_RUN)
+    {
+        for (size_t i = 0; i < EEM_HEX_RUN; i++)
+        {
+            /* Biased exponent 254 and infinities do not fit, NaN does */
+            do
+            {
+                bits = rng();
+                memcpy(&f, &bits, sizeof f);
+            } while ((bits >> 23 & 0xFF) >= 254 && !std::isnan(f));
+            a[i] = f;
+        }
+        roundTrip(a, EEM_HEX_RUN);
+    }
+    return failures != 0;
+}
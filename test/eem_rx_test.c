@@ -0,0 +1,231 @@
+/*
+ * eem_rx_feed() on a stream of frames and control characters with stray
+ * bytes in between, fed whole, split in two at every offset and a byte
+ * at a time: each way must give the same events and frames. Frames whose
+ * byte sum is below 0x20 check the block check character, and frames
+ * too short or too long must be dropped.
+ */
+#include "eem_rx.h"
+#include <stdio.h>
+
+#define EEM_RX_EVENTS 16	/* Events of one stream, at most */
+
+struct event {
+    eem_rx_event_t type;
+    size_t len;
+    uint8_t bcc;
+    uint8_t sum;
+    char buf[EEM_MTU + 1];
+};
+
+struct events {
+    size_t count;
+    struct event e[EEM_RX_EVENTS];
+};
+
+static unsigned failures;
+
+static void
+fail(const char *stream, const char *what)
+{
+    if (failures++ < 10) {
+	fprintf(stderr, "%s: %s\n", stream, what);
+    }
+}
+
+/* Append an addressed frame with payload and its block check character */
+static size_t
+frame(char *p, const char *payload)
+{
+    char *start = p;
+    uint8_t sum = 0;
+    char *q;
+    *p++ = SOH;
+    q = p;
+    p += sprintf(p, "010000%c%s*%c", STX, payload, ETX);
+    for (; q < p; q++) {
+	sum += (uint8_t)*q;
+    }
+    *p++ = eem_bcc(sum);
+    return p - start;
+}
+
+/* Feed data in pieces of at most step bytes, split once at split */
+static void
+feed(const char *data, size_t len, size_t split, size_t step,
+     struct events *ev)
+{
+    static struct eem_rx rx;
+    size_t off = 0;
+    size_t n;
+    size_t used;
+    eem_rx_event_t type;
+    struct event *e;
+    memset(&rx, 0, sizeof rx);
+    ev->count = 0;
+    while (off < len) {
+	n = len - off < step ? len - off : step;
+	if (off < split && off + n > split) {
+	    n = split - off;
+	}
+	/* As eem_readcb() does, feed the rest of a piece again */
+	while (n) {
+	    type = eem_rx_feed(&rx, data + off, n, &used);
+	    off += used;
+	    n -= used;
+	    if (type == EEM_RX_MORE || ev->count == EEM_RX_EVENTS) {
+		continue;
+	    }
+	    e = &ev->e[ev->count++];
+	    e->type = type;
+	    e->len = type == EEM_RX_FRAME ? rx.len : 0;
+	    e->bcc = type == EEM_RX_FRAME ? rx.bcc : 0;
+	    e->sum = type == EEM_RX_FRAME ? eem_bcc(rx.sum) : 0;
+	    memcpy(e->buf, rx.buf, e->len);
+	}
+    }
+}
+
+static bool
+same(const struct events *a, const struct events *b)
+{
+    size_t i;
+    if (a->count != b->count) {
+	return false;
+    }
+    for (i = 0; i < a->count; i++) {
+	if (a->e[i].type != b->e[i].type || a->e[i].len != b->e[i].len
+	    || a->e[i].bcc != b->e[i].bcc || a->e[i].sum != b->e[i].sum
+	    || memcmp(a->e[i].buf, b->e[i].buf, a->e[i].len)) {
+	    return false;
+	}
+    }
+    return true;
+}
+
+/* Every way of feeding the stream must give the events of feeding it whole */
+static void
+check(const char *name, const char *data, size_t len,
+      const struct events *want)
+{
+    static struct events got;
+    size_t i;
+    feed(data, len, len, len, &got);
+    if (!same(&got, want)) {
+	fail(name, "wrong events fed whole");
+    }
+    for (i = 1; i < len; i++) {
+	feed(data, len, i, len, &got);
+	if (!same(&got, want)) {
+	    fail(name, "wrong events when split");
+	    break;
+	}
+    }
+    feed(data, len, len, 1, &got);
+    if (!same(&got, want)) {
+	fail(name, "wrong events a byte at a time");
+    }
+}
+
+static void
+want_event(struct events *ev, eem_rx_event_t type)
+{
+    struct event *e = &ev->e[ev->count++];
+    memset(e, 0, sizeof *e);
+    e->type = type;
+}
+
+/* The frame framed by frame() from payload, checksum good */
+static void
+want_frame(struct events *ev, const char *payload)
+{
+    struct event *e = &ev->e[ev->count++];
+    char buf[EEM_MTU];
+    size_t n = frame(buf, payload);
+    memset(e, 0, sizeof *e);
+    e->type = EEM_RX_FRAME;
+    e->len = n - 2;
+    e->bcc = (uint8_t)buf[n - 1];
+    e->sum = e->bcc;
+    memcpy(e->buf, buf + 1, e->len);
+}
+
+int
+main(void)
+{
+    static char data[4 * EEM_MTU];
+    static struct events want;
+    char low[8];
+    unsigned lows = 0;
+    uint8_t sum;
+    size_t n;
+    size_t i;
+    char c;
+
+    /* Stray bytes before SOH, back to back ACK, EOT and NAK */
+    n = 0;
+    n += sprintf(data + n, "junk\r\n");
+    n += frame(data + n, "0000!00!4250D6B0");
+    data[n++] = ACK;
+    data[n++] = EOT;
+    n += sprintf(data + n, "\xff%c", 0x7f);
+    n += frame(data + n, "0200!0002!0003");
+    data[n++] = NAK;
+    data[n++] = EOT;
+    data[n++] = ACK;
+    want.count = 0;
+    want_frame(&want, "0000!00!4250D6B0");
+    want_event(&want, EEM_RX_ACK);
+    want_event(&want, EEM_RX_EOT);
+    want_frame(&want, "0200!0002!0003");
+    want_event(&want, EEM_RX_NAK);
+    want_event(&want, EEM_RX_EOT);
+    want_event(&want, EEM_RX_ACK);
+    check("frames and control characters", data, n, &want);
+
+    /* Byte sums that leave less than 0x20 in the low 7 bits */
+    for (c = '0'; c <= 'z'; c++) {
+	snprintf(low, sizeof low, "0000!%c", c);
+	n = frame(data, low);
+	sum = 0;
+	for (i = 1; i < n - 1; i++) {
+	    sum += (uint8_t)data[i];
+	}
+	if ((sum & 0x7F) >= 0x20) {
+	    continue;
+	}
+	lows++;
+	if ((uint8_t)data[n - 1] != (sum & 0x7F) + 0x20) {
+	    fail(low, "block check character not raised by 0x20");
+	}
+	want.count = 0;
+	want_frame(&want, low);
+	check(low, data, n, &want);
+	/* A wrong one is passed on for the caller to report */
+	data[n - 1] = sum & 0x7F;
+	want.e[0].bcc = sum & 0x7F;
+	check(low, data, n, &want);
+    }
+    if (!lows) {
+	fail("low sums", "no frame sums below 0x20");
+    }
+
+    /* Too short to carry an address, dropped */
+    n = sprintf(data, "%c%c%c%c", SOH, STX, ETX, ' ');
+    n += frame(data + n, "0100!1");
+    want.count = 0;
+    want_frame(&want, "0100!1");
+    check("short frame", data, n, &want);
+
+    /* A frame that overruns EEM_MTU is dropped through its ETX */
+    data[0] = SOH;
+    memset(data + 1, 'A', EEM_MTU + 10);
+    n = EEM_MTU + 11;
+    data[n++] = ETX;
+    data[n++] = ' ';
+    n += frame(data + n, "0100!2");
+    want.count = 0;
+    want_frame(&want, "0100!2");
+    check("runaway frame", data, n, &want);
+    return failures != 0;
+}
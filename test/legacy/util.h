@@ -0,0 +1,21 @@
+#ifndef TEST_LEGACY_UTIL_H
+#define TEST_LEGACY_UTIL_H
+
+/*
+ * Stand-in for the platform util.h the C engine is built against: just
+ * what eem_parse.c needs to be linked into a test.
+ */
+#include <stdbool.h>
+
+#define MAXCOUNT(a) (sizeof (a) / sizeof (a)[0])
+
+/* MO class indexes the block table refers to */
+typedef enum {
+    Rectifiers_index = 1,
+    Rectifier_index,
+    LoadDisconnect_index,
+    SolarConverters_index,
+    SolarConverter_index,
+} class_index_t;
+
+#endif